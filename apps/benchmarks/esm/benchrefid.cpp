@@ -99,6 +99,23 @@ namespace
         return generateSerializedRefIds(generateESM3ExteriorCellRefIds(random), serialize);
     }
 
+    // Constructs ids from the same texts in every thread, the number of texts is given by the first argument
+    void constructStringRefId(benchmark::State& state)
+    {
+        std::minstd_rand random;
+        std::vector<std::string> texts;
+        texts.reserve(static_cast<std::size_t>(state.range(0)));
+        std::generate_n(std::back_inserter(texts), state.range(0), [&] { return generateText(32, random); });
+        std::size_t i = static_cast<std::size_t>(state.thread_index()) * texts.size() / state.threads();
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(ESM::StringRefId(texts[i]));
+            if (++i >= texts.size())
+                i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
     void serializeRefId(benchmark::State& state)
     {
         std::minstd_rand random;
@@ -235,6 +252,7 @@ namespace
     }
 }
 
+BENCHMARK(constructStringRefId)->Arg(64)->Arg(refIdsCount)->ThreadRange(1, 8)->UseRealTime();
 BENCHMARK(serializeRefId)->RangeMultiplier(4)->Range(8, 64);
 BENCHMARK(deserializeRefId)->RangeMultiplier(4)->Range(8, 64);
 BENCHMARK(serializeTextStringRefId)->RangeMultiplier(4)->Range(8, 64);
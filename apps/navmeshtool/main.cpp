@@ -121,6 +121,10 @@ namespace NavMeshTool
             addOption("remove-unused-tiles", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "remove tiles from cache that will not be used with current content profile");
 
+            addOption("incremental", bpo::value<bool>()->implicit_value(true)->default_value(false),
+                "record hashes of tiles input and skip generation for tiles with the same input as in the previous "
+                "run");
+
             addOption("write-binary-log", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "write progress in binary messages to be consumed by the launcher");
 
@@ -180,6 +184,7 @@ namespace NavMeshTool
 
             const bool processInteriorCells = variables["process-interior-cells"].as<bool>();
             const bool removeUnusedTiles = variables["remove-unused-tiles"].as<bool>();
+            const bool incremental = variables["incremental"].as<bool>();
             const bool writeBinaryLog = variables["write-binary-log"].as<bool>();
 
 #ifdef WIN32
@@ -233,7 +238,7 @@ namespace NavMeshTool
                 navigatorSettings, readers, vfs, bulletShapeManager, esmData, processInteriorCells, writeBinaryLog);
 
             const Status status = generateAllNavMeshTiles(agentBounds, navigatorSettings, threadsNumber,
-                removeUnusedTiles, writeBinaryLog, cellsData, std::move(db));
+                removeUnusedTiles, incremental, writeBinaryLog, cellsData, std::move(db));
 
             switch (status)
             {
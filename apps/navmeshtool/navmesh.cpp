@@ -94,6 +94,8 @@ namespace NavMeshTool
 
             std::size_t getUpdated() const { return mUpdated.load(); }
 
+            std::size_t getUnchanged() const { return mUnchanged.load(); }
+
             std::size_t getDeleted() const
             {
                 const std::lock_guard lock(mMutex);
@@ -142,20 +144,22 @@ namespace NavMeshTool
                 report();
             }
 
-            void insert(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t version,
+            std::int64_t insert(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t version,
                 const std::vector<std::byte>& input, PreparedNavMeshData& data) override
             {
+                TileId tileId;
                 {
                     std::lock_guard lock(mMutex);
                     if (mRemoveUnusedTiles)
                         mDeleted += static_cast<std::size_t>(mDb.deleteTilesAt(worldspace, tilePosition));
-                    data.mUserId = static_cast<unsigned>(mNextTileId);
-                    mDb.insertTile(
-                        mNextTileId, worldspace, tilePosition, TileVersion{ version }, input, serialize(data));
+                    tileId = mNextTileId;
+                    data.mUserId = static_cast<unsigned>(tileId);
+                    mDb.insertTile(tileId, worldspace, tilePosition, TileVersion{ version }, input, serialize(data));
                     ++mNextTileId;
                 }
                 ++mInserted;
                 report();
+                return tileId;
             }
 
             void update(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t tileId,
@@ -173,6 +177,27 @@ namespace NavMeshTool
                 report();
             }
 
+            std::optional<std::int64_t> findInputHash(std::string_view worldspace, const TilePosition& tilePosition,
+                const std::vector<std::byte>& inputHash) override
+            {
+                std::optional<std::int64_t> result;
+                {
+                    std::lock_guard lock(mMutex);
+                    if (const auto tileId = mDb.findTileInputHash(worldspace, tilePosition, inputHash))
+                        result = *tileId;
+                }
+                if (result.has_value())
+                    ++mUnchanged;
+                return result;
+            }
+
+            void setInputHash(std::string_view worldspace, const TilePosition& tilePosition,
+                const std::vector<std::byte>& inputHash, std::int64_t tileId) override
+            {
+                std::lock_guard lock(mMutex);
+                mDb.insertTileInputHash(worldspace, tilePosition, inputHash, TileId{ tileId });
+            }
+
             void cancel(std::string_view reason) override
             {
                 std::unique_lock lock(mMutex);
@@ -223,6 +248,7 @@ namespace NavMeshTool
                 mTransaction.commit();
                 Log(Debug::Info) << "Removing tiles outside processed range for worldspace \"" << worldspace << "\"...";
                 mDeleted += static_cast<std::size_t>(mDb.deleteTilesOutsideRange(worldspace, range));
+                mDb.deleteTileInputHashesOutsideRange(worldspace, range);
                 mTransaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
             }
 
@@ -230,6 +256,7 @@ namespace NavMeshTool
             std::atomic_size_t mProvided{ 0 };
             std::atomic_size_t mInserted{ 0 };
             std::atomic_size_t mUpdated{ 0 };
+            std::atomic_size_t mUnchanged{ 0 };
             std::size_t mDeleted = 0;
             Status mStatus = Status::Ok;
             mutable std::mutex mMutex;
@@ -255,9 +282,10 @@ namespace NavMeshTool
     }
 
     Status generateAllNavMeshTiles(const AgentBounds& agentBounds, const Settings& settings, std::size_t threadsNumber,
-        bool removeUnusedTiles, bool writeBinaryLog, WorldspaceData& data, NavMeshDb&& db)
+        bool removeUnusedTiles, bool incremental, bool writeBinaryLog, WorldspaceData& data, NavMeshDb&& db)
     {
-        Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers...";
+        Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers"
+                         << (incremental ? " skipping tiles with unchanged input..." : "...");
 
         SceneUtil::WorkQueue workQueue(threadsNumber);
         auto navMeshTileConsumer
@@ -289,7 +317,7 @@ namespace NavMeshTool
 
             for (const TilePosition& tilePosition : worldspaceTiles)
                 workQueue.addWorkItem(new GenerateNavMeshTile(input->mWorldspace, tilePosition,
-                    RecastMeshProvider(input->mTileCachedRecastMeshManager), agentBounds, settings,
+                    RecastMeshProvider(input->mTileCachedRecastMeshManager), agentBounds, settings, incremental,
                     navMeshTileConsumer));
         }
 
@@ -300,10 +328,14 @@ namespace NavMeshTool
         const auto inserted = navMeshTileConsumer->getInserted();
         const auto updated = navMeshTileConsumer->getUpdated();
         const auto deleted = navMeshTileConsumer->getDeleted();
+        const auto unchanged = navMeshTileConsumer->getUnchanged();
 
         Log(Debug::Info) << "Generated navmesh for " << navMeshTileConsumer->getProvided() << " tiles, " << inserted
                          << " are inserted, " << updated << " updated and " << deleted << " deleted";
 
+        if (incremental)
+            Log(Debug::Info) << unchanged << " tiles are skipped because of unchanged input";
+
         if (inserted + updated + deleted > 0)
         {
             Log(Debug::Info) << "Vacuuming the database...";
@@ -0,0 +1,108 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include <osg/Stats>
+#include <osgViewer/Viewer>
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/conversion.hpp>
+
+#include "profile.hpp"
+
+namespace OMW
+{
+    namespace
+    {
+        void writeMilliseconds(std::ostream& stream, const osg::Stats* stats, unsigned frameNumber,
+            const std::string& attribute)
+        {
+            double value = 0;
+            if (stats != nullptr)
+                stats->getAttribute(frameNumber, attribute, value);
+            stream << ',' << value * 1000;
+        }
+    }
+
+    Benchmark::Benchmark(const BenchmarkSettings& settings, osgViewer::Viewer& viewer)
+        : mFrames(settings.mFrames)
+        , mTimestep(settings.mTimestep)
+    {
+        if (!settings.mScript.empty())
+        {
+            std::ifstream script(settings.mScript);
+            if (!script.is_open())
+                throw std::runtime_error(
+                    "Failed to open benchmark script: " + Files::pathToUnicodeString(settings.mScript));
+
+            std::string line;
+            for (std::size_t lineNumber = 1; std::getline(script, line); ++lineNumber)
+            {
+                const std::size_t start = line.find_first_not_of(" \t\r");
+                if (start == std::string::npos || line[start] == ';')
+                    continue;
+                std::istringstream stream(line);
+                Command command;
+                if (!(stream >> command.mFrame))
+                    throw std::runtime_error("Invalid frame number in benchmark script "
+                        + Files::pathToUnicodeString(settings.mScript) + " at line " + std::to_string(lineNumber));
+                std::getline(stream >> std::ws, command.mCommand);
+                mCommands.push_back(std::move(command));
+            }
+
+            std::stable_sort(mCommands.begin(), mCommands.end(),
+                [](const Command& l, const Command& r) { return l.mFrame < r.mFrame; });
+        }
+
+        mOutput.open(settings.mOutput);
+        if (!mOutput.is_open())
+            throw std::runtime_error(
+                "Failed to open benchmark output file: " + Files::pathToUnicodeString(settings.mOutput));
+
+        viewer.getViewerStats()->collectStats("engine", true);
+        viewer.getCamera()->getStats()->collectStats("rendering", true);
+
+        mOutput << std::fixed << std::setprecision(3) << "frame,total";
+        forEachUserStatsValue([&](const UserStats& v) { mOutput << ',' << v.mName; });
+        mOutput << ",cull,draw\n";
+
+        Log(Debug::Info) << "Running benchmark for " << mFrames << " frames with " << mTimestep
+                         << "s timestep, timings in milliseconds will be written to " << settings.mOutput;
+
+        mFrameStart = std::chrono::steady_clock::now();
+    }
+
+    std::vector<std::string> Benchmark::takeCommands()
+    {
+        std::vector<std::string> result;
+        for (; mNextCommand < mCommands.size() && mCommands[mNextCommand].mFrame <= mFrame; ++mNextCommand)
+            result.push_back(mCommands[mNextCommand].mCommand);
+        return result;
+    }
+
+    void Benchmark::finishFrame(const osgViewer::Viewer& viewer)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const unsigned frameNumber = viewer.getFrameStamp()->getFrameNumber();
+        const osg::Stats* const stats = viewer.getViewerStats();
+
+        mOutput << mFrame << ',' << std::chrono::duration<double, std::milli>(now - mFrameStart).count();
+        forEachUserStatsValue([&](const UserStats& v) { writeMilliseconds(mOutput, stats, frameNumber, v.mTaken); });
+        const osg::Stats* const cameraStats = viewer.getCamera()->getStats();
+        writeMilliseconds(mOutput, cameraStats, frameNumber, "Cull traversal time taken");
+        writeMilliseconds(mOutput, cameraStats, frameNumber, "Draw traversal time taken");
+        mOutput << '\n';
+
+        ++mFrame;
+        mFrameStart = now;
+
+        if (isDone())
+        {
+            mOutput.flush();
+            Log(Debug::Info) << "Benchmark is finished after " << mFrame << " frames";
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef OPENMW_BENCHMARK_H
+#define OPENMW_BENCHMARK_H
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace osgViewer
+{
+    class Viewer;
+}
+
+namespace OMW
+{
+    struct BenchmarkSettings
+    {
+        // Benchmark is disabled when empty
+        std::filesystem::path mOutput;
+        std::filesystem::path mScript;
+        unsigned mFrames = 0;
+        float mTimestep = 0;
+        bool mRender = true;
+    };
+
+    /// Counts frames of the main loop running with a fixed timestep, provides console commands scheduled for them and
+    /// writes timings of each frame as CSV.
+    /// @note Every script line has a form of "<frame> <console command>", empty lines and lines starting with ';' are
+    /// ignored.
+    class Benchmark
+    {
+    public:
+        explicit Benchmark(const BenchmarkSettings& settings, osgViewer::Viewer& viewer);
+
+        float getTimestep() const { return mTimestep; }
+
+        bool isDone() const { return mFrame >= mFrames; }
+
+        /// @return console commands to execute before the current frame.
+        std::vector<std::string> takeCommands();
+
+        /// Writes timings of the frame finished by the viewer and starts the next one.
+        void finishFrame(const osgViewer::Viewer& viewer);
+
+    private:
+        struct Command
+        {
+            unsigned mFrame;
+            std::string mCommand;
+        };
+
+        const unsigned mFrames;
+        const float mTimestep;
+        std::vector<Command> mCommands;
+        std::size_t mNextCommand = 0;
+        unsigned mFrame = 0;
+        std::chrono::steady_clock::time_point mFrameStart;
+        std::ofstream mOutput;
+    };
+}
+
+#endif
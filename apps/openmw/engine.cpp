@@ -3,6 +3,7 @@
 #include <cerrno>
 #include <chrono>
 #include <future>
+#include <optional>
 #include <system_error>
 
 #include <osgDB/WriteFile>
@@ -12,6 +13,7 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/debug/gldebug.hpp>
+#include <components/debug/tracing.hpp>
 
 #include <components/misc/rng.hpp>
 
@@ -27,6 +29,8 @@
 
 #include <components/compiler/extensions0.hpp>
 
+#include <components/shader/shadermanager.hpp>
+
 #include <components/stereo/multiview.hpp>
 #include <components/stereo/stereomanager.hpp>
 
@@ -166,6 +170,8 @@ void OMW::Engine::executeLocalScripts()
 
 bool OMW::Engine::frame(float frametime)
 {
+    const Debug::ScopedTrace trace("frame");
+
     const osg::Timer_t frameStart = mViewer->getStartTick();
     const unsigned int frameNumber = mViewer->getFrameStamp()->getFrameNumber();
     const osg::Timer* const timer = osg::Timer::instance();
@@ -188,7 +194,8 @@ bool OMW::Engine::frame(float frametime)
         {
             ScopedProfile<UserStatsType::Sound> profile(frameStart, frameNumber, *timer, *stats);
 
-            if (!mWindowManager->isWindowVisible())
+            // Benchmark window is hidden when it doesn't render
+            if (!mWindowManager->isWindowVisible() && mBenchmarkSettings.mOutput.empty())
             {
                 mSoundManager->pausePlayback();
                 return false;
@@ -323,7 +330,11 @@ bool OMW::Engine::frame(float frametime)
 
     mLuaWorker->allowUpdate(); // if there is a separate Lua thread, it starts the update now
 
-    mViewer->renderingTraversals();
+    if (mBenchmarkSettings.mOutput.empty() || mBenchmarkSettings.mRender)
+    {
+        const Debug::ScopedTrace trace("rendering");
+        mViewer->renderingTraversals();
+    }
 
     mLuaWorker->finishUpdate();
 
@@ -391,6 +402,10 @@ OMW::Engine::~Engine()
 
     mViewer = nullptr;
 
+    if (mResourceSystem != nullptr && Settings::shaders().mPreloadShaderVariants)
+        mResourceSystem->getSceneManager()->getShaderManager().saveShaderVariants(
+            mCfgMgr.getUserDataPath() / "shadervariants.txt");
+
     mResourceSystem.reset();
 
     mEncoder = nullptr;
@@ -458,7 +473,8 @@ void OMW::Engine::createWindow()
     Settings::WindowMode windowMode
         = static_cast<Settings::WindowMode>(Settings::Manager::getInt("window mode", "Video"));
     bool windowBorder = Settings::Manager::getBool("window border", "Video");
-    int vsync = Settings::Manager::getInt("vsync mode", "Video");
+    // Benchmark measures frames as fast as they can be done
+    int vsync = mBenchmarkSettings.mOutput.empty() ? Settings::Manager::getInt("vsync mode", "Video") : 0;
     unsigned int antialiasing = std::max(0, Settings::Manager::getInt("antialiasing", "Video"));
 
     int pos_x = SDL_WINDOWPOS_CENTERED_DISPLAY(screen), pos_y = SDL_WINDOWPOS_CENTERED_DISPLAY(screen);
@@ -469,7 +485,11 @@ void OMW::Engine::createWindow()
         pos_y = SDL_WINDOWPOS_UNDEFINED_DISPLAY(screen);
     }
 
-    Uint32 flags = SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI;
+    Uint32 flags = SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI;
+    if (mBenchmarkSettings.mOutput.empty() || mBenchmarkSettings.mRender)
+        flags |= SDL_WINDOW_SHOWN;
+    else
+        flags |= SDL_WINDOW_HIDDEN;
     if (windowMode == Settings::WindowMode::Fullscreen)
         flags |= SDL_WINDOW_FULLSCREEN;
     else if (windowMode == Settings::WindowMode::WindowedFullscreen)
@@ -746,8 +766,10 @@ void OMW::Engine::prepareEngine()
 
     Loading::Listener* listener = MWBase::Environment::get().getWindowManager()->getLoadingScreen();
     Loading::AsyncListener asyncListener(*listener);
-    auto dataLoading = std::async(std::launch::async,
-        [&] { mWorld->loadData(mFileCollections, mContentFiles, mGroundcoverFiles, mEncoder.get(), &asyncListener); });
+    auto dataLoading = std::async(std::launch::async, [&] {
+        mWorld->loadData(
+            mFileCollections, mContentFiles, mGroundcoverFiles, mEncoder.get(), mWorkQueue.get(), &asyncListener);
+    });
 
     if (!mSkipMenu)
     {
@@ -767,6 +789,17 @@ void OMW::Engine::prepareEngine()
 
     mWorld->init(mViewer, rootNode, mWorkQueue.get(), *mUnrefQueue);
     mEnvironment.setWorldScene(mWorld->getWorldScene());
+
+    if (Settings::shaders().mPreloadShaderVariants)
+    {
+        // Global defines are set by the rendering manager created on world init
+        osg::ref_ptr<osg::GraphicsOperation> compileShaders
+            = mResourceSystem->getSceneManager()->getShaderManager().preloadShaderVariants(
+                mCfgMgr.getUserDataPath() / "shadervariants.txt");
+        if (compileShaders != nullptr)
+            mViewer->getCamera()->getGraphicsContext()->add(compileShaders);
+    }
+
     mWorld->setupPlayer();
     mWorld->setRandomSeed(mRandomSeed);
 
@@ -852,6 +885,15 @@ void OMW::Engine::go()
 
     Misc::Rng::init(mRandomSeed);
 
+    Debug::setTraceThreadName("Main");
+    if (!mTraceFile.empty())
+    {
+        Debug::setTraceFile(mTraceFile);
+        Debug::setTracing(true);
+    }
+    else
+        Debug::setTraceFile(mCfgMgr.getUserDataPath() / "trace.json");
+
     Settings::ShaderManager::get().load(mCfgMgr.getUserConfigPath() / "shaders.yaml");
 
     MWClass::registerClasses();
@@ -866,6 +908,10 @@ void OMW::Engine::go()
     // Do not try to outsmart the OS thread scheduler (see bug #4785).
     mViewer->setUseConfigureAffinity(false);
 
+    // Cull and draw of a frame have to be done before its timings are written
+    if (!mBenchmarkSettings.mOutput.empty())
+        mViewer->setThreadingModel(osgViewer::ViewerBase::SingleThreaded);
+
     mEnvironment.setFrameRateLimit(Settings::Manager::getFloat("framerate limit", "Video"));
 
     prepareEngine();
@@ -934,16 +980,30 @@ void OMW::Engine::go()
         mWindowManager->executeInConsole(mStartupScript);
     }
 
+    std::optional<Benchmark> benchmark;
+    if (!mBenchmarkSettings.mOutput.empty())
+        benchmark.emplace(mBenchmarkSettings, *mViewer);
+
     // Start the main rendering loop
     MWWorld::DateTimeManager& timeManager = *mWorld->getTimeManager();
     Misc::FrameRateLimiter frameRateLimiter = Misc::makeFrameRateLimiter(mEnvironment.getFrameRateLimit());
     const std::chrono::steady_clock::duration maxSimulationInterval(std::chrono::milliseconds(200));
     while (!mViewer->done() && !mStateManager->hasQuitRequest())
     {
-        const double dt = std::chrono::duration_cast<std::chrono::duration<double>>(
-                              std::min(frameRateLimiter.getLastFrameDuration(), maxSimulationInterval))
-                              .count()
-            * timeManager.getSimulationTimeScale();
+        double dt = 0;
+        if (benchmark.has_value())
+        {
+            if (benchmark->isDone())
+                break;
+            dt = benchmark->getTimestep() * timeManager.getSimulationTimeScale();
+            for (const std::string& command : benchmark->takeCommands())
+                mWindowManager->executeCommandInConsole(command);
+        }
+        else
+            dt = std::chrono::duration_cast<std::chrono::duration<double>>(
+                     std::min(frameRateLimiter.getLastFrameDuration(), maxSimulationInterval))
+                     .count()
+                * timeManager.getSimulationTimeScale();
 
         mViewer->advance(timeManager.getSimulationTime());
 
@@ -971,11 +1031,17 @@ void OMW::Engine::go()
             }
         }
 
-        frameRateLimiter.limit();
+        if (benchmark.has_value())
+            benchmark->finishFrame(*mViewer);
+        else
+            frameRateLimiter.limit();
     }
 
     mLuaWorker->join();
 
+    if (!mTraceFile.empty())
+        Debug::writeTraceFile();
+
     // Save user settings
     Settings::Manager::saveUser(mCfgMgr.getUserConfigPath() / "settings.cfg");
     Settings::ShaderManager::get().save();
@@ -1039,6 +1105,16 @@ void OMW::Engine::setSaveGameFile(const std::filesystem::path& savegame)
     mSaveGameFile = savegame;
 }
 
+void OMW::Engine::setTraceFile(const std::filesystem::path& path)
+{
+    mTraceFile = path;
+}
+
+void OMW::Engine::setBenchmark(const BenchmarkSettings& settings)
+{
+    mBenchmarkSettings = settings;
+}
+
 void OMW::Engine::setRandomSeed(unsigned int seed)
 {
     mRandomSeed = seed;
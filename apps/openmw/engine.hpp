@@ -12,6 +12,7 @@
 #include <osgViewer/Viewer>
 #include <osgViewer/ViewerEventHandlers>
 
+#include "benchmark.hpp"
 #include "mwbase/environment.hpp"
 
 namespace Resource
@@ -168,6 +169,8 @@ namespace OMW
         std::filesystem::path mStartupScript;
         int mActivationDistanceOverride;
         std::filesystem::path mSaveGameFile;
+        std::filesystem::path mTraceFile;
+        BenchmarkSettings mBenchmarkSettings;
         // Grab mouse?
         bool mGrab;
 
@@ -260,6 +263,12 @@ namespace OMW
         /// Set the save game file to load after initialising the engine.
         void setSaveGameFile(const std::filesystem::path& savegame);
 
+        /// Record trace of the engine subsystems from the start and write it to the file on exit.
+        void setTraceFile(const std::filesystem::path& path);
+
+        /// Run the main loop with a fixed timestep for a number of frames, write their timings and quit.
+        void setBenchmark(const BenchmarkSettings& settings);
+
         void setRandomSeed(unsigned int seed);
 
     private:
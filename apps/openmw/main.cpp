@@ -156,6 +156,17 @@ bool parseOptions(int argc, char** argv, OMW::Engine& engine, Files::Configurati
     engine.setScriptBlacklist(scriptBlacklist);
     engine.setScriptBlacklistUse(variables["script-blacklist-use"].as<bool>());
     engine.setSaveGameFile(variables["load-savegame"].as<Files::MaybeQuotedPath>().u8string());
+    engine.setTraceFile(variables["trace-file"].as<Files::MaybeQuotedPath>().u8string());
+
+    OMW::BenchmarkSettings benchmark;
+    benchmark.mOutput = variables["benchmark"].as<Files::MaybeQuotedPath>().u8string();
+    benchmark.mScript = variables["benchmark-script"].as<Files::MaybeQuotedPath>().u8string();
+    benchmark.mFrames = variables["benchmark-frames"].as<unsigned>();
+    benchmark.mTimestep = variables["benchmark-timestep"].as<float>();
+    benchmark.mRender = !variables["benchmark-no-render"].as<bool>();
+    if (!benchmark.mOutput.empty())
+        engine.setGrabMouse(false);
+    engine.setBenchmark(benchmark);
 
     // other settings
     Fallback::Map::init(variables["fallback"].as<FallbackMap>().mMap);
@@ -224,6 +224,9 @@ namespace MWBase
         ///< Is the given sound currently playing on the given object?
         ///  If you want to check if sound played with playSound is playing, use empty Ptr
 
+        virtual void preloadSound(const ESM::RefId& soundId) = 0;
+        ///< Decode the given sound in background, so it doesn't have to be decoded when played for the first time.
+
         virtual void pauseSounds(MWSound::BlockerType blocker, int types = int(Type::Mask)) = 0;
         ///< Pauses all currently playing sounds, including music.
 
@@ -206,6 +206,20 @@ namespace MWClass
         }
     }
 
+    void Creature::getSoundsToPreload(const MWWorld::Ptr& ptr, std::vector<ESM::RefId>& sounds) const
+    {
+        const MWWorld::LiveCellRef<ESM::Creature>* ref = ptr.get<ESM::Creature>();
+        const ESM::RefId& ourId = (ref->mBase->mOriginal.empty()) ? ptr.getCellRef().getRefId() : ref->mBase->mOriginal;
+
+        // Sounds shared with the creatures of the same model are not worth looking up here
+        for (const ESM::SoundGenerator* sound :
+            MWBase::Environment::get().getESMStore()->get<ESM::SoundGenerator>().getByCreature(ourId))
+        {
+            if (!sound->mSound.empty())
+                sounds.push_back(sound->mSound);
+        }
+    }
+
     std::string_view Creature::getName(const MWWorld::ConstPtr& ptr) const
     {
         const MWWorld::LiveCellRef<ESM::Creature>* ref = ptr.get<ESM::Creature>();
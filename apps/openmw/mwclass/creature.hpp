@@ -110,6 +110,8 @@ namespace MWClass
         ///< Get a list of models to preload that this object may use (directly or indirectly). default implementation:
         ///< list getModel().
 
+        void getSoundsToPreload(const MWWorld::Ptr& ptr, std::vector<ESM::RefId>& sounds) const override;
+
         bool isBipedal(const MWWorld::ConstPtr& ptr) const override;
         bool canFly(const MWWorld::ConstPtr& ptr) const override;
         bool canSwim(const MWWorld::ConstPtr& ptr) const override;
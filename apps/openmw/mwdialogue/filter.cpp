@@ -1,5 +1,8 @@
 #include "filter.hpp"
 
+#include <cstdint>
+#include <optional>
+
 #include <components/compiler/locals.hpp>
 #include <components/esm/refid.hpp>
 #include <components/esm3/loadcrea.hpp>
@@ -24,10 +27,46 @@
 #include "../mwmechanics/magiceffects.hpp"
 #include "../mwmechanics/npcstats.hpp"
 
+#include "infoindex.hpp"
 #include "selectwrapper.hpp"
 
 namespace
 {
+    MWDialogue::InfoIndex::Speaker getSpeaker(const MWWorld::Ptr& actor)
+    {
+        MWDialogue::InfoIndex::Speaker speaker;
+        speaker.mId = actor.getCellRef().getRefId();
+        if (actor.getType() == ESM::NPC::sRecordId)
+        {
+            const ESM::NPC* npc = actor.get<ESM::NPC>()->mBase;
+            speaker.mIsNpc = true;
+            speaker.mRace = npc->mRace;
+            speaker.mClass = npc->mClass;
+            speaker.mFaction = actor.getClass().getPrimaryFaction(actor);
+        }
+        return speaker;
+    }
+
+    // Calls the function for the infos that may be said by the speaker in the dialogue order until it returns false
+    template <class Function>
+    void forEachCandidate(
+        const ESM::Dialogue& dialogue, const MWDialogue::InfoIndex::Speaker& speaker, Function&& function)
+    {
+        const MWWorld::Store<ESM::Dialogue>& dialogues = MWBase::Environment::get().getESMStore()->get<ESM::Dialogue>();
+
+        std::optional<MWDialogue::InfoIndex> temporary;
+        const MWDialogue::InfoIndex* index = dialogues.searchInfoIndex(dialogue);
+        if (index == nullptr)
+            index = &temporary.emplace(dialogue);
+
+        std::vector<std::uint32_t> candidates;
+        index->getCandidates(speaker, candidates);
+
+        for (const std::uint32_t candidate : candidates)
+            if (!function(index->getEntries()[candidate]))
+                return;
+    }
+
     bool matchesStaticFilters(const MWDialogue::SelectWrapper& select, const MWWorld::Ptr& actor)
     {
         const ESM::RefId selectId = ESM::RefId::stringRefId(select.getName());
@@ -205,11 +244,10 @@ bool MWDialogue::Filter::testPlayer(const ESM::DialInfo& info) const
     return true;
 }
 
-bool MWDialogue::Filter::testSelectStructs(const ESM::DialInfo& info) const
+bool MWDialogue::Filter::testSelectStructs(const std::vector<SelectWrapper>& selects) const
 {
-    for (std::vector<ESM::DialInfo::SelectStruct>::const_iterator iter(info.mSelects.begin());
-         iter != info.mSelects.end(); ++iter)
-        if (!testSelectStruct(*iter))
+    for (const SelectWrapper& select : selects)
+        if (!testSelectStruct(select))
             return false;
 
     return true;
@@ -698,23 +736,26 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 {
     std::vector<MWDialogue::Filter::Response> infos;
 
+    const InfoIndex::Speaker speaker = getSpeaker(mActor);
+
     bool infoRefusal = false;
 
     // Iterate over topic responses to find a matching one
-    for (const auto& info : dialogue.mInfo)
-    {
-        if (testActor(info) && testPlayer(info) && testSelectStructs(info))
+    forEachCandidate(dialogue, speaker, [&](const InfoIndex::Entry& entry) {
+        const ESM::DialInfo& info = *entry.mInfo;
+        if (testActor(info) && testPlayer(info) && testSelectStructs(entry.mSelects))
         {
             if (testDisposition(info, invertDisposition))
             {
                 infos.emplace_back(&dialogue, &info);
                 if (!searchAll)
-                    break;
+                    return false;
             }
             else
                 infoRefusal = true;
         }
-    }
+        return true;
+    });
 
     if (infos.empty() && infoRefusal && fallbackToInfoRefusal)
     {
@@ -725,14 +766,17 @@ std::vector<MWDialogue::Filter::Response> MWDialogue::Filter::list(
 
         const ESM::Dialogue& infoRefusalDialogue = *dialogues.find(ESM::RefId::stringRefId("Info Refusal"));
 
-        for (const auto& info : infoRefusalDialogue.mInfo)
-            if (testActor(info) && testPlayer(info) && testSelectStructs(info)
+        forEachCandidate(infoRefusalDialogue, speaker, [&](const InfoIndex::Entry& entry) {
+            const ESM::DialInfo& info = *entry.mInfo;
+            if (testActor(info) && testPlayer(info) && testSelectStructs(entry.mSelects)
                 && testDisposition(info, invertDisposition))
             {
                 infos.emplace_back(&infoRefusalDialogue, &info);
                 if (!searchAll)
-                    break;
+                    return false;
             }
+            return true;
+        });
     }
 
     return infos;
@@ -29,7 +29,7 @@ namespace MWDialogue
         bool testPlayer(const ESM::DialInfo& info) const;
         ///< Do the player and the cell the player is currently in match \a info?
 
-        bool testSelectStructs(const ESM::DialInfo& info) const;
+        bool testSelectStructs(const std::vector<SelectWrapper>& selects) const;
         ///< Are all select structs matching?
 
         bool testDisposition(const ESM::DialInfo& info, bool invert = false) const;
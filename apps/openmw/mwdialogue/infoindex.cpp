@@ -0,0 +1,75 @@
+#include "infoindex.hpp"
+
+#include <algorithm>
+
+#include <components/esm3/loaddial.hpp>
+
+namespace MWDialogue
+{
+    namespace
+    {
+        void addCandidates(
+            const std::vector<std::uint32_t>& bucket, std::size_t first, std::vector<std::uint32_t>& candidates)
+        {
+            if (bucket.empty())
+                return;
+            const std::size_t size = candidates.size();
+            candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+            // Each bucket is sorted, merging keeps the candidates in the dialogue order
+            std::inplace_merge(candidates.begin() + first, candidates.begin() + size, candidates.end());
+        }
+
+        void addCandidates(const std::unordered_map<ESM::RefId, std::vector<std::uint32_t>>& buckets,
+            const ESM::RefId& key, std::size_t first, std::vector<std::uint32_t>& candidates)
+        {
+            if (key.empty())
+                return;
+            const auto it = buckets.find(key);
+            if (it != buckets.end())
+                addCandidates(it->second, first, candidates);
+        }
+    }
+
+    InfoIndex::InfoIndex(const ESM::Dialogue& dialogue)
+    {
+        mEntries.reserve(dialogue.mInfo.size());
+
+        for (const ESM::DialInfo& info : dialogue.mInfo)
+        {
+            const std::uint32_t index = static_cast<std::uint32_t>(mEntries.size());
+
+            Entry& entry = mEntries.emplace_back(Entry{ &info, {} });
+            entry.mSelects.reserve(info.mSelects.size());
+            for (const ESM::DialInfo::SelectStruct& select : info.mSelects)
+                entry.mSelects.emplace_back(select);
+
+            // Matches the order of the checks in Filter::testActor. Infos without an actor id are never said by
+            // creatures, all the other conditions are only tested for NPCs.
+            if (!info.mActor.empty())
+                mByActor[info.mActor].push_back(index);
+            else if (!info.mRace.empty())
+                mByRace[info.mRace].push_back(index);
+            else if (!info.mClass.empty())
+                mByClass[info.mClass].push_back(index);
+            else if (!info.mFactionLess && !info.mFaction.empty())
+                mByFaction[info.mFaction].push_back(index);
+            else
+                mGeneric.push_back(index);
+        }
+    }
+
+    void InfoIndex::getCandidates(const Speaker& speaker, std::vector<std::uint32_t>& candidates) const
+    {
+        const std::size_t first = candidates.size();
+
+        addCandidates(mByActor, speaker.mId, first, candidates);
+
+        if (!speaker.mIsNpc)
+            return;
+
+        addCandidates(mByRace, speaker.mRace, first, candidates);
+        addCandidates(mByClass, speaker.mClass, first, candidates);
+        addCandidates(mByFaction, speaker.mFaction, first, candidates);
+        addCandidates(mGeneric, first, candidates);
+    }
+}
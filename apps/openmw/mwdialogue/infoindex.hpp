@@ -0,0 +1,60 @@
+#ifndef GAME_MWDIALOGUE_INFOINDEX_H
+#define GAME_MWDIALOGUE_INFOINDEX_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <components/esm/refid.hpp>
+
+#include "selectwrapper.hpp"
+
+namespace ESM
+{
+    struct Dialogue;
+}
+
+namespace MWDialogue
+{
+    /// Infos of a single dialogue with decoded select structs, grouped by the most specific speaker condition
+    /// (actor id, race, class or faction) so only infos not rejected upfront by the speaker have to be tested.
+    /// \attention Refers to the dialogue infos, the dialogue must not be modified while the index is used.
+    class InfoIndex
+    {
+    public:
+        struct Entry
+        {
+            const ESM::DialInfo* mInfo;
+            std::vector<SelectWrapper> mSelects;
+        };
+
+        struct Speaker
+        {
+            ESM::RefId mId;
+            bool mIsNpc = false;
+            ESM::RefId mRace;
+            ESM::RefId mClass;
+            ESM::RefId mFaction;
+        };
+
+        explicit InfoIndex(const ESM::Dialogue& dialogue);
+
+        const std::vector<Entry>& getEntries() const { return mEntries; }
+
+        void getCandidates(const Speaker& speaker, std::vector<std::uint32_t>& candidates) const;
+        ///< Append indices of the entries that may match \a speaker in the dialogue order. The speaker
+        /// conditions of the infos have to be tested anyway, the index only skips infos that can't match.
+
+    private:
+        using Buckets = std::unordered_map<ESM::RefId, std::vector<std::uint32_t>>;
+
+        std::vector<Entry> mEntries;
+        Buckets mByActor;
+        Buckets mByRace;
+        Buckets mByClass;
+        Buckets mByFaction;
+        std::vector<std::uint32_t> mGeneric;
+    };
+}
+
+#endif
@@ -172,10 +172,16 @@ MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::decodeFunction()
 
 MWDialogue::SelectWrapper::SelectWrapper(const ESM::DialInfo::SelectStruct& select)
     : mSelect(select)
+    , mFunction(decodeSelectRule())
+    , mType(getFunctionType(mFunction))
+    , mNpcOnly(isNpcOnlyFunction(mFunction))
+    , mName(mSelect.mSelectRule.size() > 5
+              ? Misc::StringUtils::lowerCase(std::string_view(mSelect.mSelectRule).substr(5))
+              : std::string())
 {
 }
 
-MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::getFunction() const
+MWDialogue::SelectWrapper::Function MWDialogue::SelectWrapper::decodeSelectRule() const
 {
     char type = mSelect.mSelectRule[1];
 
@@ -317,7 +323,7 @@ int MWDialogue::SelectWrapper::getArgument() const
     return 0;
 }
 
-MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
+MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getFunctionType(Function function)
 {
     static const Function integerFunctions[] = {
         Function_Journal,
@@ -387,8 +393,6 @@ MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
         Function_None,
     };
 
-    Function function = getFunction();
-
     for (int i = 0; integerFunctions[i] != Function_None; ++i)
         if (integerFunctions[i] == function)
             return Type_Integer;
@@ -408,7 +412,7 @@ MWDialogue::SelectWrapper::Type MWDialogue::SelectWrapper::getType() const
     return Type_None;
 }
 
-bool MWDialogue::SelectWrapper::isNpcOnly() const
+bool MWDialogue::SelectWrapper::isNpcOnlyFunction(Function function)
 {
     static const Function functions[] = {
         Function_NotFaction,
@@ -428,8 +432,6 @@ bool MWDialogue::SelectWrapper::isNpcOnly() const
         Function_None,
     };
 
-    Function function = getFunction();
-
     for (int i = 0; functions[i] != Function_None; ++i)
         if (functions[i] == function)
             return true;
@@ -452,7 +454,3 @@ bool MWDialogue::SelectWrapper::selectCompare(bool value) const
     return selectCompareImp(mSelect, static_cast<int>(value));
 }
 
-std::string MWDialogue::SelectWrapper::getName() const
-{
-    return Misc::StringUtils::lowerCase(std::string_view(mSelect.mSelectRule).substr(5));
-}
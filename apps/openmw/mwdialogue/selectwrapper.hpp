@@ -3,8 +3,11 @@
 
 #include <components/esm3/loadinfo.hpp>
 
+#include <string>
+
 namespace MWDialogue
 {
+    /// Select struct of a dialogue info with the rule decoded once on construction.
     class SelectWrapper
     {
         const ESM::DialInfo::SelectStruct& mSelect;
@@ -73,18 +76,29 @@ namespace MWDialogue
         };
 
     private:
+        Function mFunction;
+        Type mType;
+        bool mNpcOnly;
+        std::string mName;
+
         Function decodeFunction() const;
 
+        Function decodeSelectRule() const;
+
+        static Type getFunctionType(Function function);
+
+        static bool isNpcOnlyFunction(Function function);
+
     public:
         SelectWrapper(const ESM::DialInfo::SelectStruct& select);
 
-        Function getFunction() const;
+        Function getFunction() const { return mFunction; }
 
         int getArgument() const;
 
-        Type getType() const;
+        Type getType() const { return mType; }
 
-        bool isNpcOnly() const;
+        bool isNpcOnly() const { return mNpcOnly; }
         ///< \attention Do not call any of the select functions for this select struct!
 
         bool selectCompare(int value) const;
@@ -93,7 +107,7 @@ namespace MWDialogue
 
         bool selectCompare(bool value) const;
 
-        std::string getName() const;
+        const std::string& getName() const { return mName; }
         ///< Return case-smashed name.
     };
 }
@@ -1457,6 +1457,11 @@ namespace MWGui
         mConsole->executeFile(path);
     }
 
+    void WindowManager::executeCommandInConsole(const std::string& command)
+    {
+        mConsole->execute(command);
+    }
+
     MWGui::InventoryWindow* WindowManager::getInventoryWindow()
     {
         return mInventoryWindow;
@@ -296,6 +296,8 @@ namespace MWGui
 
         void executeInConsole(const std::filesystem::path& path) override;
 
+        void executeCommandInConsole(const std::string& command) override;
+
         void enableRest() override { mRestAllowed = true; }
         bool getRestEnabled() override;
 
@@ -72,31 +72,45 @@ namespace MWLua
 
     void ObjectLists::ObjectGroup::updateList()
     {
-        if (mChanged)
+        std::vector<ObjectId>& list = *mList;
+        for (const auto& [id, added] : mPendingChanges)
         {
-            mList->clear();
-            for (const ObjectId& id : mSet)
-                mList->push_back(id);
-            mChanged = false;
+            if (added)
+            {
+                if (mIndices.emplace(id, list.size()).second)
+                    list.push_back(id);
+                continue;
+            }
+
+            const auto it = mIndices.find(id);
+            if (it == mIndices.end())
+                continue;
+            const std::size_t index = it->second;
+            mIndices.erase(it);
+            if (index != list.size() - 1)
+            {
+                list[index] = list.back();
+                mIndices[list[index]] = index;
+            }
+            list.pop_back();
         }
+        mPendingChanges.clear();
     }
 
     void ObjectLists::ObjectGroup::clear()
     {
-        mChanged = false;
         mList->clear();
-        mSet.clear();
+        mIndices.clear();
+        mPendingChanges.clear();
     }
 
     void ObjectLists::addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
-        group.mSet.insert(getId(ptr));
-        group.mChanged = true;
+        group.mPendingChanges.emplace_back(getId(ptr), true);
     }
 
     void ObjectLists::removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
-        group.mSet.erase(getId(ptr));
-        group.mChanged = true;
+        group.mPendingChanges.emplace_back(getId(ptr), false);
     }
 }
@@ -1,7 +1,8 @@
 #ifndef MWLUA_OBJECTLISTS_H
 #define MWLUA_OBJECTLISTS_H
 
-#include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "object.hpp"
 
@@ -28,14 +29,18 @@ namespace MWLua
         void setPlayer(const MWWorld::Ptr& player) { *mPlayers = { getId(player) }; }
 
     private:
+        // Lua keeps references to mList. It is modified only by updateList, so the lists don't change while scripts
+        // are running. Changes are applied in place: new objects are appended, removed ones are replaced by the last.
         struct ObjectGroup
         {
             void updateList();
             void clear();
 
-            bool mChanged = false;
             ObjectIdList mList = std::make_shared<std::vector<ObjectId>>();
-            std::set<ObjectId> mSet;
+            // Positions of the objects in mList
+            std::unordered_map<ObjectId, std::size_t> mIndices;
+            // Objects added (true) or removed (false) since the last updateList, in order of the changes
+            std::vector<std::pair<ObjectId, bool>> mPendingChanges;
         };
 
         ObjectGroup* chooseGroup(const MWWorld::Ptr& ptr);
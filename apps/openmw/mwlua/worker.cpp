@@ -5,6 +5,7 @@
 #include <apps/openmw/profile.hpp>
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/tracing.hpp>
 #include <components/settings/values.hpp>
 
 #include <osgViewer/Viewer>
@@ -76,6 +77,7 @@ namespace MWLua
 
     void Worker::run() noexcept
     {
+        Debug::setTraceThreadName("Lua");
         while (true)
         {
             std::unique_lock<std::mutex> lk(mMutex);
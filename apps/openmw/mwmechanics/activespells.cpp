@@ -1,5 +1,6 @@
 #include "activespells.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <components/debug/debuglog.hpp>
@@ -271,11 +272,25 @@ namespace MWMechanics
         const MWWorld::Ptr player = MWMechanics::getPlayer();
         bool updatedHitOverlay = false;
         bool updatedEnemy = false;
+        // Searching for an actor goes through all the active cells, but the spells are usually cast by a few actors and
+        // most of them by the actor itself (abilities, constant effect enchantments, potions), so search each once.
+        std::vector<std::pair<int, MWWorld::Ptr>> casters;
+        const auto getCaster = [&](int casterActorId) {
+            if (creatureStats.matchesActorId(casterActorId))
+                return ptr;
+            const auto found = std::find_if(
+                casters.begin(), casters.end(), [&](const auto& caster) { return caster.first == casterActorId; });
+            if (found != casters.end())
+                return found->second;
+            // Maybe make this search outside active grid?
+            MWWorld::Ptr caster = MWBase::Environment::get().getWorld()->searchPtrViaActorId(casterActorId);
+            casters.emplace_back(casterActorId, caster);
+            return caster;
+        };
         // Update effects
         for (auto spellIt = mSpells.begin(); spellIt != mSpells.end();)
         {
-            const auto caster = MWBase::Environment::get().getWorld()->searchPtrViaActorId(
-                spellIt->mCasterActorId); // Maybe make this search outside active grid?
+            const MWWorld::Ptr caster = getCaster(spellIt->mCasterActorId);
             bool removedSpell = false;
             std::optional<ActiveSpellParams> reflected;
             for (auto it = spellIt->mEffects.begin(); it != spellIt->mEffects.end();)
@@ -229,6 +229,14 @@ namespace
         ptr.getClass().getCreatureStats(ptr).getActiveSpells().unloadActor(ptr);
     }
 
+    // Distant actors are animated at a lower rate
+    unsigned int getAnimationUpdateInterval(float distance, int lodDistance)
+    {
+        if (lodDistance <= 0 || distance < lodDistance)
+            return 1;
+        return distance < 2 * lodDistance ? 3 : 5;
+    }
+
 }
 
 namespace MWMechanics
@@ -1513,6 +1521,7 @@ namespace MWMechanics
             }
             const bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
             const int actorsProcessingRange = Settings::game().mActorsProcessingRange;
+            const int animationLodDistance = Settings::game().mAnimationLodDistance;
 
             // AI and magic effects update
             for (Actor& actor : mActors)
@@ -1652,6 +1661,7 @@ namespace MWMechanics
 
                 CharacterController& ctrl = actor.getCharacterController();
                 ctrl.setActive(active);
+                ctrl.setAnimationUpdateInterval(isPlayer ? 1 : getAnimationUpdateInterval(dist, animationLodDistance));
 
                 if (!inRange)
                 {
@@ -2857,6 +2857,11 @@ namespace MWMechanics
         mAnimation->setActive(active);
     }
 
+    void CharacterController::setAnimationUpdateInterval(unsigned int interval) const
+    {
+        mAnimation->setUpdateInterval(interval);
+    }
+
     void CharacterController::setHeadTrackTarget(const MWWorld::ConstPtr& target)
     {
         mHeadTrackTarget = target;
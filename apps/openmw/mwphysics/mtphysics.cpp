@@ -15,6 +15,7 @@
 #include <osg/Stats>
 
 #include "components/debug/debuglog.hpp"
+#include "components/debug/tracing.hpp"
 #include "components/misc/convert.hpp"
 #include "components/settings/settings.hpp"
 #include <components/misc/barrier.hpp>
@@ -743,8 +744,10 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::worker()
     {
+        Debug::setTraceThreadName("Physics");
         mWorkersSync->runWorker([this] {
             std::shared_lock lock(mSimulationMutex);
+            const Debug::ScopedTrace trace("physicsworker");
             doSimulation();
         });
     }
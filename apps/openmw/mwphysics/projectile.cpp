@@ -93,16 +93,10 @@ namespace MWPhysics
         }();
     }
 
-    void Projectile::setValidTargets(const std::vector<MWWorld::Ptr>& targets)
+    void Projectile::setValidTargets(const std::vector<const btCollisionObject*>& targets)
     {
         std::scoped_lock lock(mMutex);
-        mValidTargets.clear();
-        for (const auto& ptr : targets)
-        {
-            const auto* physicActor = mPhysics->getActor(ptr);
-            if (physicActor)
-                mValidTargets.push_back(physicActor->getCollisionObject());
-        }
+        mValidTargets = targets;
     }
 
     bool Projectile::isValidTarget(const btCollisionObject* target) const
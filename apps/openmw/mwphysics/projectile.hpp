@@ -48,7 +48,7 @@ namespace MWPhysics
 
         void hit(const btCollisionObject* target, btVector3 pos, btVector3 normal);
 
-        void setValidTargets(const std::vector<MWWorld::Ptr>& targets);
+        void setValidTargets(const std::vector<const btCollisionObject*>& targets);
         bool isValidTarget(const btCollisionObject* target) const;
 
         btVector3 getHitPosition() const { return mHitPosition; }
@@ -444,7 +444,10 @@ namespace MWRender
     {
         osg::ref_ptr<const SceneUtil::KeyframeHolder> mKeyframes;
 
-        typedef std::map<std::string, osg::ref_ptr<SceneUtil::KeyframeController>> ControllerMap;
+        // Controllers are mapped to the bones of this Animation resolved when the source is added, so activating
+        // them doesn't need to look up the bones by name again
+        typedef std::map<osg::ref_ptr<osg::MatrixTransform>, osg::ref_ptr<SceneUtil::KeyframeController>>
+            ControllerMap;
 
         ControllerMap mControllerMap[Animation::sNumBlendMasks];
 
@@ -547,6 +550,12 @@ namespace MWRender
             mSkeleton->setActive(static_cast<SceneUtil::Skeleton::ActiveType>(active));
     }
 
+    void Animation::setUpdateInterval(unsigned int interval)
+    {
+        if (mSkeleton)
+            mSkeleton->setUpdateInterval(interval);
+    }
+
     void Animation::updatePtr(const MWWorld::Ptr& ptr)
     {
         mPtr = ptr;
@@ -638,25 +647,23 @@ namespace MWRender
         for (SceneUtil::KeyframeHolder::KeyframeControllerMap::const_iterator it = controllerMap.begin();
              it != controllerMap.end(); ++it)
         {
-            std::string bonename = Misc::StringUtils::lowerCase(it->first);
-            NodeMap::const_iterator found = nodeMap.find(bonename);
+            NodeMap::const_iterator found = nodeMap.find(it->first);
             if (found == nodeMap.end())
             {
-                Log(Debug::Warning) << "Warning: addAnimSource: can't find bone '" + bonename << "' in " << baseModel
+                Log(Debug::Warning) << "Warning: addAnimSource: can't find bone '"
+                                    << Misc::StringUtils::lowerCase(it->first) << "' in " << baseModel
                                     << " (referenced by " << kfname << ")";
                 continue;
             }
 
-            osg::Node* node = found->second;
-
-            size_t blendMask = detectBlendMask(node, it->second->getName());
+            size_t blendMask = detectBlendMask(found->second, it->second->getName());
 
             // clone the controller, because each Animation needs its own ControllerSource
             osg::ref_ptr<SceneUtil::KeyframeController> cloned
                 = osg::clone(it->second.get(), osg::CopyOp::SHALLOW_COPY);
             cloned->setSource(mAnimationTimePtr[blendMask]);
 
-            animsrc->mControllerMap[blendMask].insert(std::make_pair(bonename, cloned));
+            animsrc->mControllerMap[blendMask].emplace(found->second, std::move(cloned));
         }
 
         mAnimSources.push_back(std::move(animsrc));
@@ -678,17 +685,13 @@ namespace MWRender
                 found = nodeMap.find(name);
                 if (found == nodeMap.end())
                     continue;
-                for (SceneUtil::KeyframeHolder::KeyframeControllerMap::const_iterator it = controllerMap.begin();
-                     it != controllerMap.end(); ++it)
+                const AnimSource& source = *mAnimSources.back();
+                if (std::any_of(std::begin(source.mControllerMap), std::end(source.mControllerMap),
+                        [&](const AnimSource::ControllerMap& ctrls) { return ctrls.contains(found->second); }))
                 {
-                    if (Misc::StringUtils::ciEqual(it->first, name))
-                    {
-                        mAccumRoot = found->second;
-                        break;
-                    }
-                }
-                if (mAccumRoot)
+                    mAccumRoot = found->second;
                     break;
+                }
             }
         }
     }
@@ -979,8 +982,7 @@ namespace MWRender
                 for (AnimSource::ControllerMap::iterator it = animsrc->mControllerMap[blendMask].begin();
                      it != animsrc->mControllerMap[blendMask].end(); ++it)
                 {
-                    osg::ref_ptr<osg::Node> node = getNodeMap().at(
-                        it->first); // this should not throw, we already checked for the node existing in addAnimSource
+                    osg::ref_ptr<osg::Node> node = it->first;
 
                     osg::Callback* callback = it->second->getAsCallback();
                     node->addUpdateCallback(callback);
@@ -1097,7 +1099,7 @@ namespace MWRender
         const AnimSource::ControllerMap& ctrls = (*animsrc)->mControllerMap[0];
         for (AnimSource::ControllerMap::const_iterator it = ctrls.begin(); it != ctrls.end(); ++it)
         {
-            if (Misc::StringUtils::ciEqual(it->first, mAccumRoot->getName()))
+            if (it->first.get() == mAccumRoot.get())
             {
                 velocity = calcAnimVelocity(keys, it->second, mAccumulate, groupname);
                 break;
@@ -1118,7 +1120,7 @@ namespace MWRender
                 const AnimSource::ControllerMap& ctrls2 = (*animiter)->mControllerMap[0];
                 for (AnimSource::ControllerMap::const_iterator it = ctrls2.begin(); it != ctrls2.end(); ++it)
                 {
-                    if (Misc::StringUtils::ciEqual(it->first, mAccumRoot->getName()))
+                    if (it->first.get() == mAccumRoot.get())
                     {
                         velocity = calcAnimVelocity(keys2, it->second, mAccumulate, groupname);
                         break;
@@ -1,5 +1,7 @@
 #include "groundcover.hpp"
 
+#include <algorithm>
+
 #include <osg/AlphaFunc>
 #include <osg/BlendFunc>
 #include <osg/ComputeBoundsVisitor>
@@ -8,12 +10,11 @@
 #include <osg/VertexAttribDivisor>
 #include <osgUtil/CullVisitor>
 
-#include <components/esm3/esmreader.hpp>
 #include <components/esm3/loadland.hpp>
-#include <components/esm3/readerscache.hpp>
 #include <components/misc/convert.hpp>
 #include <components/sceneutil/lightmanager.hpp>
 #include <components/sceneutil/nodecallback.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/settings/values.hpp>
 #include <components/shader/shadermanager.hpp>
 #include <components/terrain/quadtreenode.hpp>
@@ -242,34 +243,6 @@ namespace MWRender
             osg::Vec3f mChunkPosition;
         };
 
-        class DensityCalculator
-        {
-        public:
-            DensityCalculator(float density)
-                : mDensity(density)
-            {
-            }
-
-            bool isInstanceEnabled()
-            {
-                if (mDensity >= 1.f)
-                    return true;
-
-                mCurrentGroundcover += mDensity;
-                if (mCurrentGroundcover < 1.f)
-                    return false;
-
-                mCurrentGroundcover -= 1.f;
-
-                return true;
-            }
-            void reset() { mCurrentGroundcover = 0.f; }
-
-        private:
-            float mCurrentGroundcover = 0.f;
-            float mDensity = 0.f;
-        };
-
         class ViewDistanceCallback : public SceneUtil::NodeCallback<ViewDistanceCallback>
         {
         public:
@@ -289,13 +262,16 @@ namespace MWRender
             osg::BoundingBox mBox;
         };
 
-        inline bool isInChunkBorders(ESM::CellRef& ref, osg::Vec2f& minBound, osg::Vec2f& maxBound)
+        // Smaller chunks are built at once as the gain doesn't cover queueing the work
+        constexpr std::size_t minInstancesPerPart = 4096;
+
+        inline bool isInChunkBorders(const ESM::Position& position, osg::Vec2f& minBound, osg::Vec2f& maxBound)
         {
             osg::Vec2f size = maxBound - minBound;
             if (size.x() >= 1 && size.y() >= 1)
                 return true;
 
-            osg::Vec3f pos = ref.mPos.asVec3();
+            osg::Vec3f pos = position.asVec3();
             osg::Vec3f cellPos = pos / ESM::Land::REAL_SIZE;
             if ((minBound.x() > std::floor(minBound.x()) && cellPos.x() < minBound.x())
                 || (minBound.y() > std::floor(minBound.y()) && cellPos.y() < minBound.y())
@@ -326,11 +302,11 @@ namespace MWRender
         }
     }
 
-    Groundcover::Groundcover(
-        Resource::SceneManager* sceneManager, float density, float viewDistance, const MWWorld::GroundcoverStore& store)
+    Groundcover::Groundcover(Resource::SceneManager* sceneManager, SceneUtil::WorkQueue* workQueue, float viewDistance,
+        const MWWorld::GroundcoverStore& store)
         : GenericResourceManager<GroundcoverChunkId>(nullptr, Settings::cells().mCacheExpiryDelay)
         , mSceneManager(sceneManager)
-        , mDensity(density)
+        , mWorkQueue(workQueue)
         , mStateset(new osg::StateSet)
         , mGroundcoverStore(store)
     {
@@ -355,54 +331,26 @@ namespace MWRender
 
     void Groundcover::collectInstances(InstanceMap& instances, float size, const osg::Vec2f& center)
     {
-        if (mDensity <= 0.f)
-            return;
-
         osg::Vec2f minBound = (center - osg::Vec2f(size / 2.f, size / 2.f));
         osg::Vec2f maxBound = (center + osg::Vec2f(size / 2.f, size / 2.f));
-        DensityCalculator calculator(mDensity);
-        ESM::ReadersCache readers;
         osg::Vec2i startCell = osg::Vec2i(std::floor(center.x() - size / 2.f), std::floor(center.y() - size / 2.f));
         for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
         {
             for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
             {
-                ESM::Cell cell;
-                mGroundcoverStore.initCell(cell, cellX, cellY);
-                if (cell.mContextList.empty())
-                    continue;
-
-                calculator.reset();
-                std::map<ESM::RefNum, ESM::CellRef> refs;
-                for (size_t i = 0; i < cell.mContextList.size(); ++i)
+                // instances of a cell are ordered by model
+                std::vector<GroundcoverEntry>* entries = nullptr;
+                std::uint32_t model = 0;
+                for (const MWWorld::GroundcoverInstance& instance : mGroundcoverStore.getInstances(cellX, cellY))
                 {
-                    const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                    const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                    cell.restore(*reader, i);
-                    ESM::CellRef ref;
-                    bool deleted = false;
-                    while (cell.getNextRef(*reader, ref, deleted))
+                    if (!isInChunkBorders(instance.mPos, minBound, maxBound))
+                        continue;
+                    if (entries == nullptr || instance.mModel != model)
                     {
-                        if (!deleted && refs.find(ref.mRefNum) == refs.end() && !calculator.isInstanceEnabled())
-                            deleted = true;
-                        if (!deleted && !isInChunkBorders(ref, minBound, maxBound))
-                            deleted = true;
-
-                        if (deleted)
-                        {
-                            refs.erase(ref.mRefNum);
-                            continue;
-                        }
-                        refs[ref.mRefNum] = std::move(ref);
+                        model = instance.mModel;
+                        entries = &instances[model];
                     }
-                }
-
-                for (auto& pair : refs)
-                {
-                    ESM::CellRef& ref = pair.second;
-                    const std::string& model = mGroundcoverStore.getGroundcoverModel(ref.mRefID);
-                    if (!model.empty())
-                        instances[model].emplace_back(std::move(ref));
+                    entries->emplace_back(instance.mPos, instance.mScale);
                 }
             }
         }
@@ -412,18 +360,40 @@ namespace MWRender
     {
         osg::ref_ptr<osg::Group> group = new osg::Group;
         osg::Vec3f worldCenter = osg::Vec3f(center.x(), center.y(), 0) * ESM::Land::REAL_SIZE;
-        for (auto& pair : instances)
+
+        std::vector<InstanceMap::iterator> models;
+        std::size_t numInstances = 0;
+        for (auto it = instances.begin(); it != instances.end(); ++it)
         {
-            const osg::Node* temp = mSceneManager->getTemplate(pair.first);
-            osg::ref_ptr<osg::Node> node = static_cast<osg::Node*>(temp->clone(osg::CopyOp::DEEP_COPY_NODES
-                | osg::CopyOp::DEEP_COPY_DRAWABLES | osg::CopyOp::DEEP_COPY_USERDATA | osg::CopyOp::DEEP_COPY_ARRAYS
-                | osg::CopyOp::DEEP_COPY_PRIMITIVES));
+            models.push_back(it);
+            numInstances += it->second.size();
+        }
 
-            // Keep link to original mesh to keep it in cache
-            group->getOrCreateUserDataContainer()->addUserObject(new Resource::TemplateRef(temp));
+        // Models are instanced independently from each other, so they can be split into parts built in parallel
+        std::vector<std::pair<osg::ref_ptr<const osg::Node>, osg::ref_ptr<osg::Node>>> nodes(models.size());
+        const std::size_t numParts
+            = std::min(models.size(), std::max<std::size_t>(numInstances / minInstancesPerPart, 1));
+        const auto createNodes = [&](std::size_t part) {
+            for (std::size_t i = part; i < models.size(); i += numParts)
+            {
+                osg::ref_ptr<const osg::Node> temp
+                    = mSceneManager->getTemplate(mGroundcoverStore.getModel(models[i]->first));
+                osg::ref_ptr<osg::Node> node = static_cast<osg::Node*>(temp->clone(osg::CopyOp::DEEP_COPY_NODES
+                    | osg::CopyOp::DEEP_COPY_DRAWABLES | osg::CopyOp::DEEP_COPY_USERDATA
+                    | osg::CopyOp::DEEP_COPY_ARRAYS | osg::CopyOp::DEEP_COPY_PRIMITIVES));
+
+                InstancingVisitor visitor(models[i]->second, worldCenter);
+                node->accept(visitor);
+                nodes[i] = { std::move(temp), std::move(node) };
+            }
+        };
+
+        SceneUtil::parallelFor(mWorkQueue, numParts, createNodes);
 
-            InstancingVisitor visitor(pair.second, worldCenter);
-            node->accept(visitor);
+        for (const auto& [temp, node] : nodes)
+        {
+            // Keep link to original mesh to keep it in cache
+            group->getOrCreateUserDataContainer()->addUserObject(new Resource::TemplateRef(temp.get()));
             group->addChild(node);
         }
 
@@ -14,6 +14,10 @@ namespace osg
 {
     class Program;
 }
+namespace SceneUtil
+{
+    class WorkQueue;
+}
 
 namespace MWRender
 {
@@ -22,7 +26,7 @@ namespace MWRender
                         public Terrain::QuadTreeWorld::ChunkManager
     {
     public:
-        Groundcover(Resource::SceneManager* sceneManager, float density, float viewDistance,
+        Groundcover(Resource::SceneManager* sceneManager, SceneUtil::WorkQueue* workQueue, float viewDistance,
             const MWWorld::GroundcoverStore& store);
         ~Groundcover();
 
@@ -38,21 +42,21 @@ namespace MWRender
             ESM::Position mPos;
             float mScale;
 
-            GroundcoverEntry(const ESM::CellRef& ref)
-                : mPos(ref.mPos)
-                , mScale(ref.mScale)
+            GroundcoverEntry(const ESM::Position& pos, float scale)
+                : mPos(pos)
+                , mScale(scale)
             {
             }
         };
 
     private:
         Resource::SceneManager* mSceneManager;
-        float mDensity;
+        SceneUtil::WorkQueue* mWorkQueue;
         osg::ref_ptr<osg::StateSet> mStateset;
         osg::ref_ptr<osg::Program> mProgramTemplate;
         const MWWorld::GroundcoverStore& mGroundcoverStore;
 
-        typedef std::map<std::string, std::vector<GroundcoverEntry>> InstanceMap;
+        typedef std::map<std::uint32_t, std::vector<GroundcoverEntry>> InstanceMap;
         osg::ref_ptr<osg::Node> createChunk(InstanceMap& instances, const osg::Vec2f& center);
         void collectInstances(InstanceMap& instances, float size, const osg::Vec2f& center);
     };
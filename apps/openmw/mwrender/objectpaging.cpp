@@ -23,6 +23,7 @@
 #include <components/sceneutil/optimizer.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/sceneutil/util.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/vfs/manager.hpp>
 
 #include <osgParticle/ParticleProcessor>
@@ -42,6 +43,7 @@
 #include "vismask.hpp"
 
 #include <condition_variable>
+#include <tuple>
 
 namespace MWRender
 {
@@ -453,10 +455,133 @@ namespace MWRender
         }
     };
 
-    ObjectPaging::ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace)
+    class CollectMergeStateVisitor : public osg::NodeVisitor
+    {
+    public:
+        CollectMergeStateVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            osg::StateSet* stateSet = node.getStateSet();
+            if (stateSet != nullptr)
+            {
+                mStateSets.push_back(stateSet);
+                ++mStateSetDepth;
+            }
+
+            if (const osg::Geometry* geometry = node.asGeometry())
+            {
+                // geometry without any state can be merged with any other geometry without state
+                if (mStateSetDepth == 0)
+                    mStateSets.push_back(nullptr);
+                if (const osg::Array* array = geometry->getVertexArray())
+                    mNumVerts += array->getNumElements();
+            }
+
+            traverse(node);
+
+            if (stateSet != nullptr)
+                --mStateSetDepth;
+        }
+
+        std::vector<const osg::StateSet*> mStateSets;
+        std::size_t mNumVerts = 0;
+
+    private:
+        std::size_t mStateSetDepth = 0;
+    };
+
+    namespace
+    {
+        // Smaller merges are done at once as the gain doesn't cover queueing the work
+        constexpr std::size_t minVertsPerMergeGroup = 4096;
+
+        std::size_t findRoot(std::vector<std::size_t>& parents, std::size_t index)
+        {
+            while (parents[index] != index)
+            {
+                parents[index] = parents[parents[index]];
+                index = parents[index];
+            }
+            return index;
+        }
+
+        // Geometry is merged only when it shares state. Instances not sharing any StateSet, directly or through
+        // other instances, end up in separate batches anyway and can be merged independently.
+        std::vector<osg::ref_ptr<osg::Group>> splitMergeGroup(osg::Group& mergeGroup, std::size_t maxGroups)
+        {
+            const std::size_t numChildren = mergeGroup.getNumChildren();
+            if (maxGroups <= 1 || numChildren <= 1)
+                return {};
+
+            std::vector<std::size_t> parents(numChildren);
+            std::vector<std::size_t> numVerts(numChildren);
+            std::unordered_map<const osg::StateSet*, std::size_t> owners;
+            std::size_t totalVerts = 0;
+
+            for (std::size_t i = 0; i < numChildren; ++i)
+            {
+                parents[i] = i;
+                CollectMergeStateVisitor visitor;
+                mergeGroup.getChild(i)->accept(visitor);
+                numVerts[i] = visitor.mNumVerts;
+                totalVerts += visitor.mNumVerts;
+                for (const osg::StateSet* stateSet : visitor.mStateSets)
+                {
+                    const auto [owner, inserted] = owners.emplace(stateSet, i);
+                    if (!inserted)
+                        parents[findRoot(parents, i)] = findRoot(parents, owner->second);
+                }
+            }
+
+            const std::size_t numGroups = std::min(maxGroups, totalVerts / minVertsPerMergeGroup);
+            if (numGroups <= 1)
+                return {};
+
+            std::unordered_map<std::size_t, std::size_t> componentVerts;
+            for (std::size_t i = 0; i < numChildren; ++i)
+                componentVerts[findRoot(parents, i)] += numVerts[i];
+
+            if (componentVerts.size() <= 1)
+                return {};
+
+            std::vector<std::pair<std::size_t, std::size_t>> components(componentVerts.begin(), componentVerts.end());
+            std::sort(components.begin(), components.end(), [](const auto& l, const auto& r) {
+                return std::tie(l.second, l.first) > std::tie(r.second, r.first);
+            });
+
+            // assign the largest components first to the least loaded group
+            std::vector<std::size_t> groupVerts(std::min(numGroups, components.size()), 0);
+            std::unordered_map<std::size_t, std::size_t> componentGroups;
+            for (const auto& [root, verts] : components)
+            {
+                const auto group = std::min_element(groupVerts.begin(), groupVerts.end());
+                *group += verts;
+                componentGroups.emplace(root, static_cast<std::size_t>(group - groupVerts.begin()));
+            }
+
+            std::vector<osg::ref_ptr<osg::Group>> result(groupVerts.size());
+            for (osg::ref_ptr<osg::Group>& group : result)
+                group = new osg::Group;
+            for (std::size_t i = 0; i < numChildren; ++i)
+                result[componentGroups[findRoot(parents, i)]]->addChild(mergeGroup.getChild(i));
+
+            // Optimizer doesn't flatten transforms having multiple parents
+            mergeGroup.removeChildren(0, numChildren);
+
+            return result;
+        }
+    }
+
+    ObjectPaging::ObjectPaging(
+        Resource::SceneManager* sceneManager, SceneUtil::WorkQueue* workQueue, ESM::RefId worldspace)
         : GenericResourceManager<ChunkId>(nullptr, Settings::cells().mCacheExpiryDelay)
         , Terrain::QuadTreeWorld::ChunkManager(worldspace)
         , mSceneManager(sceneManager)
+        , mWorkQueue(workQueue)
         , mRefTrackerLocked(false)
     {
         mActiveGrid = Settings::Manager::getBool("object paging active grid", "Terrain");
@@ -465,6 +590,7 @@ namespace MWRender
         mMinSize = Settings::Manager::getFloat("object paging min size", "Terrain");
         mMinSizeMergeFactor = Settings::Manager::getFloat("object paging min size merge factor", "Terrain");
         mMinSizeCostMultiplier = Settings::Manager::getFloat("object paging min size cost multiplier", "Terrain");
+        mMergeGroups = static_cast<std::size_t>(Settings::terrain().mObjectPagingMergeGroups);
     }
 
     std::map<ESM::RefNum, ESM::CellRef> ObjectPaging::collectESM3References(
@@ -810,17 +936,31 @@ namespace MWRender
 
         if (mergeGroup->getNumChildren())
         {
-            SceneUtil::Optimizer optimizer;
-            if (size > 1 / 8.f)
+            const auto optimize = [&](osg::Group* node) {
+                SceneUtil::Optimizer optimizer;
+                if (size > 1 / 8.f)
+                {
+                    optimizer.setViewPoint(relativeViewPoint);
+                    optimizer.setMergeAlphaBlending(true);
+                }
+                optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
+                unsigned int options = SceneUtil::Optimizer::FLATTEN_STATIC_TRANSFORMS
+                    | SceneUtil::Optimizer::REMOVE_REDUNDANT_NODES | SceneUtil::Optimizer::MERGE_GEOMETRY;
+
+                optimizer.optimize(node, options);
+            };
+
+            const std::vector<osg::ref_ptr<osg::Group>> mergeGroups = splitMergeGroup(*mergeGroup, mMergeGroups);
+            if (mergeGroups.empty())
+                optimize(mergeGroup);
+            else
             {
-                optimizer.setViewPoint(relativeViewPoint);
-                optimizer.setMergeAlphaBlending(true);
+                // Groups are detached from the graph so that the optimizers don't modify a shared parent
+                SceneUtil::parallelFor(
+                    mWorkQueue, mergeGroups.size(), [&](std::size_t i) { optimize(mergeGroups[i].get()); });
+                for (const osg::ref_ptr<osg::Group>& merged : mergeGroups)
+                    mergeGroup->addChild(merged);
             }
-            optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
-            unsigned int options = SceneUtil::Optimizer::FLATTEN_STATIC_TRANSFORMS
-                | SceneUtil::Optimizer::REMOVE_REDUNDANT_NODES | SceneUtil::Optimizer::MERGE_GEOMETRY;
-
-            optimizer.optimize(mergeGroup, options);
 
             group->addChild(mergeGroup);
 
@@ -16,6 +16,11 @@ namespace MWWorld
     class ESMStore;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace ESM
 {
     class ReadersCache;
@@ -29,7 +34,7 @@ namespace MWRender
     class ObjectPaging : public Resource::GenericResourceManager<ChunkId>, public Terrain::QuadTreeWorld::ChunkManager
     {
     public:
-        ObjectPaging(Resource::SceneManager* sceneManager, ESM::RefId worldspace);
+        ObjectPaging(Resource::SceneManager* sceneManager, SceneUtil::WorkQueue* workQueue, ESM::RefId worldspace);
         ~ObjectPaging() = default;
 
         osg::ref_ptr<osg::Node> getChunk(float size, const osg::Vec2f& center, unsigned char lod, unsigned int lodFlags,
@@ -59,12 +64,14 @@ namespace MWRender
 
     private:
         Resource::SceneManager* mSceneManager;
+        SceneUtil::WorkQueue* mWorkQueue;
         bool mActiveGrid;
         bool mDebugBatches;
         float mMergeFactor;
         float mMinSize;
         float mMinSizeMergeFactor;
         float mMinSizeCostMultiplier;
+        std::size_t mMergeGroups;
 
         std::mutex mRefTrackerMutex;
         struct RefTracker
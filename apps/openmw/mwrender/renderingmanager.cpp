@@ -36,6 +36,7 @@
 #include <components/sceneutil/cullsafeboundsvisitor.hpp>
 #include <components/sceneutil/depth.hpp>
 #include <components/sceneutil/lightmanager.hpp>
+#include <components/sceneutil/nodecallback.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/sceneutil/rtt.hpp>
 #include <components/sceneutil/shadow.hpp>
@@ -53,6 +54,7 @@
 #include <components/esm4/loadcell.hpp>
 
 #include <components/debug/debugdraw.hpp>
+#include <components/debug/tracing.hpp>
 #include <components/detournavigator/navigator.hpp>
 #include <components/detournavigator/navmeshcacheitem.hpp>
 
@@ -269,6 +271,16 @@ namespace MWRender
         bool mWireframe;
     };
 
+    class TraceCullCallback : public SceneUtil::NodeCallback<TraceCullCallback>
+    {
+    public:
+        void operator()(osg::Node* node, osg::NodeVisitor* nv)
+        {
+            const Debug::ScopedTrace trace("cull");
+            traverse(node, nv);
+        }
+    };
+
     class PreloadCommonAssetsWorkItem : public SceneUtil::WorkItem
     {
     public:
@@ -465,6 +477,8 @@ namespace MWRender
         mStateUpdater = new StateUpdater;
         sceneRoot->addUpdateCallback(mStateUpdater);
 
+        sceneRoot->addCullCallback(new TraceCullCallback);
+
         mSharedUniformStateUpdater = new SharedUniformStateUpdater();
         rootNode->addUpdateCallback(mSharedUniformStateUpdater);
 
@@ -1343,17 +1357,16 @@ namespace MWRender
             if (Settings::Manager::getBool("object paging", "Terrain"))
             {
                 newChunkMgr.mObjectPaging
-                    = std::make_unique<ObjectPaging>(mResourceSystem->getSceneManager(), worldspace);
+                    = std::make_unique<ObjectPaging>(mResourceSystem->getSceneManager(), mWorkQueue.get(), worldspace);
                 quadTreeWorld->addChunkManager(newChunkMgr.mObjectPaging.get());
                 mResourceSystem->addResourceManager(newChunkMgr.mObjectPaging.get());
             }
             if (groundcover)
             {
                 const float groundcoverDistance = Settings::groundcover().mRenderingDistance;
-                const float density = Settings::groundcover().mDensity;
 
                 newChunkMgr.mGroundcover = std::make_unique<Groundcover>(
-                    mResourceSystem->getSceneManager(), density, groundcoverDistance, mGroundCoverStore);
+                    mResourceSystem->getSceneManager(), mWorkQueue.get(), groundcoverDistance, mGroundCoverStore);
                 quadTreeWorld->addChunkManager(newChunkMgr.mGroundcover.get());
                 mResourceSystem->addResourceManager(newChunkMgr.mGroundcover.get());
             }
@@ -10,6 +10,7 @@
 #include <components/compiler/opcodes.hpp>
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/tracing.hpp>
 
 #include <components/interpreter/interpreter.hpp>
 #include <components/interpreter/opcodes.hpp>
@@ -1736,6 +1737,30 @@ namespace MWScript
             }
         };
 
+        class OpToggleTracing : public Interpreter::Opcode0
+        {
+        public:
+            void execute(Interpreter::Runtime& runtime) override
+            {
+                const bool enabled = !Debug::isTracing();
+                Debug::setTracing(enabled);
+                runtime.getContext().report(enabled ? "Tracing -> On" : "Tracing -> Off");
+            }
+        };
+
+        class OpWriteTrace : public Interpreter::Opcode0
+        {
+        public:
+            void execute(Interpreter::Runtime& runtime) override
+            {
+                if (Debug::writeTraceFile())
+                    runtime.getContext().report(
+                        "Trace is written to " + Files::pathToUnicodeString(Debug::getTraceFile()));
+                else
+                    runtime.getContext().report("Failed to write trace, check the log for details");
+            }
+        };
+
         void installOpcodes(Interpreter::Interpreter& interpreter)
         {
             interpreter.installSegment5<OpMenuMode>(Compiler::Misc::opcodeMenuMode);
@@ -1862,6 +1887,8 @@ namespace MWScript
             interpreter.installSegment5<OpHelp>(Compiler::Misc::opcodeHelp);
             interpreter.installSegment5<OpReloadLua>(Compiler::Misc::opcodeReloadLua);
             interpreter.installSegment5<OpTestModels>(Compiler::Misc::opcodeTestModels);
+            interpreter.installSegment5<OpToggleTracing>(Compiler::Misc::opcodeToggleTracing);
+            interpreter.installSegment5<OpWriteTrace>(Compiler::Misc::opcodeWriteTrace);
         }
     }
 }
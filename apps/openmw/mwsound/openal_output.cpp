@@ -13,7 +13,6 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/misc/constants.hpp>
-#include <components/misc/resourcehelpers.hpp>
 #include <components/misc/thread.hpp>
 #include <components/vfs/manager.hpp>
 
@@ -1093,43 +1092,29 @@ namespace MWSound
         }
     }
 
-    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(const std::string& fname)
+    std::pair<Sound_Handle, size_t> OpenAL_Output::loadSound(const DecodedSound& sound)
     {
         getALError();
 
-        std::vector<char> data;
-        ALenum format = AL_NONE;
-        int srate = 0;
+        ALenum format = getALFormat(sound.mChannelConfig, sound.mSampleType);
+        const char* data = sound.mData.data();
+        ALsizei dataSize = static_cast<ALsizei>(sound.mData.size());
+        ALsizei srate = sound.mSampleRate;
 
-        try
-        {
-            DecoderPtr decoder = mManager.getDecoder();
-            decoder->open(Misc::ResourceHelpers::correctSoundPath(fname, decoder->mResourceMgr));
-
-            ChannelConfig chans;
-            SampleType type;
-            decoder->getInfo(&srate, &chans, &type);
-            format = getALFormat(chans, type);
-            if (format)
-                decoder->readAll(data);
-        }
-        catch (std::exception& e)
-        {
-            Log(Debug::Error) << "Failed to load audio from " << fname << ": " << e.what();
-        }
-
-        if (data.empty())
+        static const std::vector<char> silence(8000, -128);
+        if (format == AL_NONE || sound.mData.empty())
         {
             // If we failed to get any usable audio, substitute with silence.
             format = AL_FORMAT_MONO8;
             srate = 8000;
-            data.assign(8000, -128);
+            data = silence.data();
+            dataSize = static_cast<ALsizei>(silence.size());
         }
 
         ALint size;
         ALuint buf = 0;
         alGenBuffers(1, &buf);
-        alBufferData(buf, format, data.data(), data.size(), srate);
+        alBufferData(buf, format, data, dataSize, srate);
         alGetBufferi(buf, AL_SIZE, &size);
         if (getALError() != AL_NO_ERROR)
         {
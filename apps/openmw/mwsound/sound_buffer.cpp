@@ -3,13 +3,19 @@
 #include "../mwbase/environment.hpp"
 #include "../mwworld/esmstore.hpp"
 
+#include "sound_decoder.hpp"
+#include "soundmanagerimp.hpp"
+
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadsoun.hpp>
 #include <components/misc/resourcehelpers.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/settings/settings.hpp>
+#include <components/settings/values.hpp>
 #include <components/vfs/pathutil.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 namespace MWSound
@@ -33,15 +39,78 @@ namespace MWSound
             params.mAudioMaxDistanceMult = settings.find("fAudioMaxDistanceMult")->mValue.getFloat();
             return params;
         }
+
+        DecodedSound decodeSound(Sound_Decoder& decoder, const std::string& fileName)
+        {
+            DecodedSound result;
+            try
+            {
+                decoder.open(Misc::ResourceHelpers::correctSoundPath(fileName, decoder.mResourceMgr));
+                decoder.getInfo(&result.mSampleRate, &result.mChannelConfig, &result.mSampleType);
+                decoder.readAll(result.mData);
+            }
+            catch (std::exception& e)
+            {
+                Log(Debug::Error) << "Failed to load audio from " << fileName << ": " << e.what();
+                result.mData.clear();
+            }
+            return result;
+        }
     }
 
-    SoundBufferPool::SoundBufferPool(Sound_Output& output)
+    /// Worker thread item: decode a whole sound file.
+    class DecodeSoundItem : public SceneUtil::WorkItem
+    {
+    public:
+        /// Constructor to be called from the main thread.
+        DecodeSoundItem(DecoderPtr decoder, const std::string& fileName)
+            : mDecoder(std::move(decoder))
+            , mFileName(fileName)
+        {
+        }
+
+        void abort() override { mAbort = true; }
+
+        /// @return true when the work wasn't started yet, then it won't be done and the caller has to do it.
+        bool abortIfNotStarted()
+        {
+            bool expected = false;
+            if (mStarted.compare_exchange_strong(expected, true))
+            {
+                mAbort = true;
+                return true;
+            }
+            return false;
+        }
+
+        void doWork() override
+        {
+            bool expected = false;
+            if (mAbort || !mStarted.compare_exchange_strong(expected, true))
+                return;
+            mResult = decodeSound(*mDecoder, mFileName);
+            mDecoder = nullptr;
+        }
+
+        DecodedSound& getResult() { return mResult; }
+
+    private:
+        DecoderPtr mDecoder;
+        std::string mFileName;
+        DecodedSound mResult;
+        std::atomic_bool mStarted{ false };
+        std::atomic_bool mAbort{ false };
+    };
+
+    SoundBufferPool::SoundBufferPool(Sound_Output& output, SoundManager& manager)
         : mOutput(&output)
+        , mManager(&manager)
         , mBufferCacheMax(std::max(Settings::Manager::getInt("buffer cache max", "Sound"), 1) * 1024 * 1024)
         , mBufferCacheMin(
               std::min(static_cast<std::size_t>(std::max(Settings::Manager::getInt("buffer cache min", "Sound"), 1))
                       * 1024 * 1024,
                   mBufferCacheMax))
+        , mDecodedCacheMax(static_cast<std::size_t>(Settings::sound().mDecodedCacheMax) * 1024 * 1024)
     {
     }
 
@@ -79,7 +148,7 @@ namespace MWSound
         if (sfx->getHandle() != nullptr)
             return sfx;
 
-        auto [handle, size] = mOutput->loadSound(sfx->getResourceName());
+        auto [handle, size] = mOutput->loadSound(takeDecoded(sfx));
         if (handle == nullptr)
             return {};
 
@@ -97,7 +166,7 @@ namespace MWSound
         return sfx;
     }
 
-    Sound_Buffer* SoundBufferPool::load(const ESM::RefId& soundId)
+    Sound_Buffer* SoundBufferPool::getSfx(const ESM::RefId& soundId)
     {
         if (mBufferNameMap.empty())
         {
@@ -105,17 +174,21 @@ namespace MWSound
                 insertSound(sound.mId, sound);
         }
 
-        Sound_Buffer* sfx;
         const auto it = mBufferNameMap.find(soundId);
         if (it != mBufferNameMap.end())
-            sfx = it->second;
-        else
-        {
-            const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
-            if (sound == nullptr)
-                return {};
-            sfx = insertSound(soundId, *sound);
-        }
+            return it->second;
+
+        const ESM::Sound* sound = MWBase::Environment::get().getESMStore()->get<ESM::Sound>().search(soundId);
+        if (sound == nullptr)
+            return nullptr;
+        return insertSound(soundId, *sound);
+    }
+
+    Sound_Buffer* SoundBufferPool::load(const ESM::RefId& soundId)
+    {
+        Sound_Buffer* sfx = getSfx(soundId);
+        if (sfx == nullptr)
+            return {};
 
         return loadSfx(sfx);
     }
@@ -134,8 +207,90 @@ namespace MWSound
         return loadSfx(sfx);
     }
 
+    void SoundBufferPool::preload(const ESM::RefId& soundId)
+    {
+        if (mDecodedCacheMax == 0)
+            return;
+
+        Sound_Buffer* sfx = getSfx(soundId);
+        if (sfx == nullptr || sfx->getHandle() != nullptr)
+            return;
+
+        const auto [it, inserted] = mDecodedSounds.try_emplace(sfx);
+        if (!inserted)
+        {
+            // Keep the sounds requested again for longer
+            const auto order = std::find(mDecodedOrder.begin(), mDecodedOrder.end(), sfx);
+            if (order != mDecodedOrder.end())
+                mDecodedOrder.erase(order);
+            mDecodedOrder.push_front(sfx);
+            return;
+        }
+
+        if (mDecodeQueue == nullptr)
+            mDecodeQueue = new SceneUtil::WorkQueue(static_cast<std::size_t>(Settings::sound().mDecodingThreads));
+
+        it->second.mItem = new DecodeSoundItem(mManager->getDecoder(), sfx->getResourceName());
+        mDecodeQueue->addWorkItem(it->second.mItem);
+        mDecodedOrder.push_front(sfx);
+    }
+
+    void SoundBufferPool::updateDecoded()
+    {
+        for (auto& [sfx, entry] : mDecodedSounds)
+        {
+            if (!entry.mDone && entry.mItem->isDone())
+            {
+                entry.mDone = true;
+                entry.mSize = entry.mItem->getResult().mData.size();
+                mDecodedCacheSize += entry.mSize;
+            }
+        }
+
+        // Sounds still being decoded are skipped, they are accounted once done
+        for (auto it = mDecodedOrder.end(); mDecodedCacheSize > mDecodedCacheMax && it != mDecodedOrder.begin();)
+        {
+            --it;
+            const auto decoded = mDecodedSounds.find(*it);
+            if (!decoded->second.mDone)
+                continue;
+            mDecodedCacheSize -= decoded->second.mSize;
+            mDecodedSounds.erase(decoded);
+            it = mDecodedOrder.erase(it);
+        }
+    }
+
+    DecodedSound SoundBufferPool::takeDecoded(Sound_Buffer* sfx)
+    {
+        const auto it = mDecodedSounds.find(sfx);
+        if (it == mDecodedSounds.end())
+            return decodeSound(*mManager->getDecoder(), sfx->getResourceName());
+
+        const osg::ref_ptr<DecodeSoundItem> item = std::move(it->second.mItem);
+        mDecodedCacheSize -= it->second.mSize;
+        mDecodedSounds.erase(it);
+        mDecodedOrder.erase(std::find(mDecodedOrder.begin(), mDecodedOrder.end(), sfx));
+
+        // A sound still waiting in the queue is decoded right away, the one in progress is waited for
+        if (item->abortIfNotStarted())
+            return decodeSound(*mManager->getDecoder(), sfx->getResourceName());
+        item->waitTillDone();
+        return std::move(item->getResult());
+    }
+
+    void SoundBufferPool::abortDecoding()
+    {
+        for (auto& [sfx, entry] : mDecodedSounds)
+            entry.mItem->abort();
+        mDecodedSounds.clear();
+        mDecodedOrder.clear();
+        mDecodedCacheSize = 0;
+    }
+
     void SoundBufferPool::clear()
     {
+        abortDecoding();
+
         for (auto& sfx : mSoundBuffers)
         {
             if (sfx.mHandle)
@@ -6,6 +6,8 @@
 #include <string>
 #include <unordered_map>
 
+#include <osg/ref_ptr>
+
 #include "sound_output.hpp"
 #include <components/esm/refid.hpp>
 
@@ -19,9 +21,15 @@ namespace VFS
     class Manager;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWSound
 {
     class SoundBufferPool;
+    class DecodeSoundItem;
 
     class Sound_Buffer
     {
@@ -59,7 +67,7 @@ namespace MWSound
     class SoundBufferPool
     {
     public:
-        SoundBufferPool(Sound_Output& output);
+        SoundBufferPool(Sound_Output& output, SoundManager& manager);
 
         SoundBufferPool(const SoundBufferPool&) = delete;
 
@@ -80,6 +88,12 @@ namespace MWSound
         // Lookup for a sound by file name, and ensure it's ready for use.
         Sound_Buffer* load(std::string_view fileName);
 
+        /// Start decoding a sound in background, so loading it later only has to upload the decoded data.
+        void preload(const ESM::RefId& soundId);
+
+        /// Account for the sounds decoded in background and drop the oldest ones exceeding the cache size.
+        void updateDecoded();
+
         void use(Sound_Buffer& sfx)
         {
             if (sfx.mUses++ == 0)
@@ -99,9 +113,24 @@ namespace MWSound
         void clear();
 
     private:
+        struct DecodedEntry
+        {
+            osg::ref_ptr<DecodeSoundItem> mItem;
+            // Size of the decoded data is accounted once it's done
+            bool mDone = false;
+            std::size_t mSize = 0;
+        };
+
+        Sound_Buffer* getSfx(const ESM::RefId& soundId);
+
         Sound_Buffer* loadSfx(Sound_Buffer* sfx);
 
+        DecodedSound takeDecoded(Sound_Buffer* sfx);
+
+        void abortDecoding();
+
         Sound_Output* mOutput;
+        SoundManager* mManager;
         std::deque<Sound_Buffer> mSoundBuffers;
         std::unordered_map<ESM::RefId, Sound_Buffer*> mBufferNameMap;
         std::unordered_map<std::string, Sound_Buffer*> mBufferFileNameMap;
@@ -110,6 +139,12 @@ namespace MWSound
         std::size_t mBufferCacheSize = 0;
         // NOTE: unused buffers are stored in front-newest order.
         std::deque<Sound_Buffer*> mUnusedBuffers;
+        osg::ref_ptr<SceneUtil::WorkQueue> mDecodeQueue;
+        std::unordered_map<Sound_Buffer*, DecodedEntry> mDecodedSounds;
+        // NOTE: decoded sounds are stored in front-newest order.
+        std::deque<Sound_Buffer*> mDecodedOrder;
+        std::size_t mDecodedCacheMax;
+        std::size_t mDecodedCacheSize = 0;
 
         inline Sound_Buffer* insertSound(const ESM::RefId& soundId, const ESM::Sound& sound);
         inline Sound_Buffer* insertSound(std::string_view fileName);
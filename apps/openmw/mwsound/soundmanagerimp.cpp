@@ -84,7 +84,7 @@ namespace MWSound
         : mVFS(vfs)
         , mOutput(std::make_unique<OpenAL_Output>(*this))
         , mWaterSoundUpdater(makeWaterSoundUpdaterSettings())
-        , mSoundBuffers(*mOutput)
+        , mSoundBuffers(*mOutput, *this)
         , mListenerUnderwater(false)
         , mListenerPos(0, 0, 0)
         , mListenerDir(1, 0, 0)
@@ -823,6 +823,14 @@ namespace MWSound
         return false;
     }
 
+    void SoundManager::preloadSound(const ESM::RefId& soundId)
+    {
+        if (!mOutput->isInitialized())
+            return;
+
+        mSoundBuffers.preload(soundId);
+    }
+
     void SoundManager::pauseSounds(BlockerType blocker, int types)
     {
         if (mOutput->isInitialized())
@@ -1142,6 +1150,7 @@ namespace MWSound
                 streamMusic(titlefile, MWSound::MusicType::Special);
         }
 
+        mSoundBuffers.updateDecoded();
         updateSounds(duration);
         if (MWBase::Environment::get().getStateManager()->getState() != MWBase::StateManager::State_NoGame)
         {
@@ -163,6 +163,7 @@ namespace MWSound
     protected:
         DecoderPtr getDecoder();
         friend class OpenAL_Output;
+        friend class SoundBufferPool;
 
         void stopSound(Sound_Buffer* sfx, const MWWorld::ConstPtr& ptr);
         ///< Stop the given object from playing given sound buffer.
@@ -282,6 +283,9 @@ namespace MWSound
         bool getSoundPlaying(const MWWorld::ConstPtr& reference, std::string_view fileName) const override;
         ///< Is the given sound currently playing on the given object?
 
+        void preloadSound(const ESM::RefId& soundId) override;
+        ///< Decode the given sound in background, so it doesn't have to be decoded when played for the first time.
+
         void pauseSounds(MWSound::BlockerType blocker, int types = int(Type::Mask)) override;
         ///< Pauses all currently playing sounds, including music.
 
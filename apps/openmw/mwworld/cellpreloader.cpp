@@ -1,11 +1,13 @@
 #include "cellpreloader.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <limits>
 
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadregn.hpp>
 #include <components/loadinglistener/reporter.hpp>
 #include <components/misc/constants.hpp>
 #include <components/misc/resourcehelpers.hpp>
@@ -18,10 +20,14 @@
 #include <components/terrain/world.hpp>
 #include <components/vfs/manager.hpp>
 
+#include "../mwbase/environment.hpp"
+#include "../mwbase/soundmanager.hpp"
+
 #include "../mwrender/landmanager.hpp"
 
 #include "cellstore.hpp"
 #include "class.hpp"
+#include "esmstore.hpp"
 
 namespace
 {
@@ -69,6 +75,49 @@ namespace MWWorld
         std::vector<std::string>& mOut;
     };
 
+    namespace
+    {
+        struct ListSoundsVisitor
+        {
+            ListSoundsVisitor(std::vector<ESM::RefId>& out)
+                : mOut(out)
+            {
+            }
+
+            bool operator()(const MWWorld::Ptr& ptr)
+            {
+                ptr.getClass().getSoundsToPreload(ptr, mOut);
+
+                return true;
+            }
+
+            std::vector<ESM::RefId>& mOut;
+        };
+
+        /// Start decoding the sounds which may be played in a cell: sounds of its objects and its region.
+        void preloadSounds(CellStore& cell)
+        {
+            std::vector<ESM::RefId> sounds;
+            ListSoundsVisitor visitor(sounds);
+            cell.forEach(visitor);
+
+            const ESM::Region* region
+                = MWBase::Environment::get().getESMStore()->get<ESM::Region>().search(cell.getCell()->getRegion());
+            if (region != nullptr)
+            {
+                for (const ESM::Region::SoundRef& sound : region->mSoundList)
+                    sounds.push_back(sound.mSound);
+            }
+
+            std::sort(sounds.begin(), sounds.end());
+            sounds.erase(std::unique(sounds.begin(), sounds.end()), sounds.end());
+
+            MWBase::SoundManager* const soundManager = MWBase::Environment::get().getSoundManager();
+            for (const ESM::RefId& sound : sounds)
+                soundManager->preloadSound(sound);
+        }
+    }
+
     /// Worker thread item: preload models in a cell.
     class PreloadItem : public SceneUtil::WorkItem
     {
@@ -293,6 +342,8 @@ namespace MWWorld
         mWorkQueue->addWorkItem(item);
 
         mPreloadCells[&cell] = PreloadEntry(timestamp, item);
+
+        preloadSounds(cell);
     }
 
     void CellPreloader::notifyLoaded(CellStore* cell)
@@ -0,0 +1,163 @@
+#include "cellrefreader.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+#include <components/sceneutil/workqueue.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+
+namespace MWWorld
+{
+    namespace
+    {
+        template <class Function>
+        void readCellRefs(const ESM::Cell& cell, std::size_t contextIndex, ESM::ESMReader& reader, Function&& function)
+        {
+            // Seek to the references of the content file
+            cell.restore(reader, static_cast<int>(contextIndex));
+
+            ESM::CellRef ref;
+            // Get each reference in turn
+            ESM::MovedCellRef cMRef;
+            bool deleted = false;
+            bool moved = false;
+            while (
+                ESM::Cell::getNextRef(reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
+            {
+                if (moved)
+                    continue;
+
+                // Don't load reference if it was moved to a different cell.
+                ESM::MovedCellRefTracker::const_iterator iter
+                    = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
+                if (iter != cell.mMovedRefs.end())
+                    continue;
+
+                function(ref, deleted);
+            }
+        }
+
+        // Readers of a work queue thread, kept open until the thread exits
+        struct WorkerReaders
+        {
+            ESM::ReadersCache mReaders;
+            const ToUTF8::StatelessUtf8Encoder* mStatelessEncoder = nullptr;
+            std::optional<ToUTF8::Utf8Encoder> mEncoder;
+        };
+
+        WorkerReaders& getWorkerReaders(const ToUTF8::StatelessUtf8Encoder* statelessEncoder)
+        {
+            thread_local WorkerReaders worker;
+
+            if (worker.mStatelessEncoder != statelessEncoder)
+            {
+                worker.mEncoder.reset();
+                if (statelessEncoder != nullptr)
+                    worker.mEncoder.emplace(*statelessEncoder);
+                worker.mStatelessEncoder = statelessEncoder;
+            }
+
+            return worker;
+        }
+
+        struct ContentFileRefs
+        {
+            std::vector<std::pair<ESM::CellRef, bool>> mRefs;
+            std::string mError;
+        };
+    }
+
+    CellRefReader::CellRefReader(ESM::ReadersCache& readers)
+        : mReaders(readers)
+    {
+    }
+
+    void CellRefReader::setWorkQueue(SceneUtil::WorkQueue* workQueue, std::size_t maxThreads)
+    {
+        mWorkQueue = workQueue;
+        mMaxThreads = workQueue == nullptr ? 1 : std::clamp<std::size_t>(maxThreads, 1, workQueue->getNumThreads() + 1);
+    }
+
+    void CellRefReader::read(const ESM::Cell& cell,
+        const std::function<void(ESM::CellRef& ref, bool deleted)>& function,
+        const std::function<void(std::string_view error)>& onError) const
+    {
+        const std::size_t numParts = std::min(mMaxThreads, cell.mContextList.size());
+
+        if (numParts <= 1)
+        {
+            for (std::size_t i = 0; i < cell.mContextList.size(); ++i)
+            {
+                try
+                {
+                    const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                    const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
+                    readCellRefs(cell, i, *reader, function);
+                }
+                catch (const std::exception& e)
+                {
+                    onError(e.what());
+                }
+            }
+            return;
+        }
+
+        std::vector<ContentFileRefs> refs(cell.mContextList.size());
+        const std::thread::id callingThread = std::this_thread::get_id();
+        const ToUTF8::StatelessUtf8Encoder* const statelessEncoder = mReaders.getStatelessEncoder();
+
+        SceneUtil::parallelFor(mWorkQueue, numParts, [&](std::size_t part) {
+            const bool isCallingThread = std::this_thread::get_id() == callingThread;
+            for (std::size_t i = part; i < cell.mContextList.size(); i += numParts)
+            {
+                const auto addRef
+                    = [&](ESM::CellRef& ref, bool deleted) { refs[i].mRefs.emplace_back(std::move(ref), deleted); };
+                try
+                {
+                    const ESM::ESM_Context& context = cell.mContextList[i];
+                    const std::size_t index = static_cast<std::size_t>(context.index);
+                    if (isCallingThread)
+                    {
+                        const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
+                        readCellRefs(cell, i, *reader, addRef);
+                        continue;
+                    }
+                    WorkerReaders& worker = getWorkerReaders(statelessEncoder);
+                    const ESM::ReadersCache::BusyItem reader = worker.mReaders.get(index);
+                    reader->setEncoder(worker.mEncoder.has_value() ? &*worker.mEncoder : nullptr);
+                    if (!reader->isOpen() || reader->getName() != context.filename)
+                        reader->open(context.filename);
+                    readCellRefs(cell, i, *reader, addRef);
+                }
+                catch (const std::exception& e)
+                {
+                    refs[i].mError = e.what();
+                }
+            }
+        });
+
+        for (ContentFileRefs& contentFileRefs : refs)
+        {
+            try
+            {
+                for (auto& [ref, deleted] : contentFileRefs.mRefs)
+                    function(ref, deleted);
+            }
+            catch (const std::exception& e)
+            {
+                onError(e.what());
+                continue;
+            }
+            if (!contentFileRefs.mError.empty())
+                onError(contentFileRefs.mError);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef GAME_MWWORLD_CELLREFREADER_H
+#define GAME_MWWORLD_CELLREFREADER_H
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace ESM
+{
+    class ReadersCache;
+    struct Cell;
+    struct CellRef;
+}
+
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
+namespace MWWorld
+{
+    /// \brief Reads references of an ESM3 cell from all content files modifying it
+    ///
+    /// Content files can be read in parallel on the work queue. Each worker thread keeps its own readers open across
+    /// cells, as readers and encoders are not thread safe. References are still passed in the load order, so they
+    /// override each other like when the content files are read one by one.
+    class CellRefReader
+    {
+    public:
+        explicit CellRefReader(ESM::ReadersCache& readers);
+
+        /// @param maxThreads number of threads reading a cell including the calling one, 1 to read on the calling
+        /// thread only
+        void setWorkQueue(SceneUtil::WorkQueue* workQueue, std::size_t maxThreads);
+
+        /// Calls function for each reference not moved to another cell, onError for each content file that failed
+        /// to be read. Must be called by the thread owning the readers.
+        void read(const ESM::Cell& cell, const std::function<void(ESM::CellRef& ref, bool deleted)>& function,
+            const std::function<void(std::string_view error)>& onError) const;
+
+    private:
+        ESM::ReadersCache& mReaders;
+        SceneUtil::WorkQueue* mWorkQueue = nullptr;
+        std::size_t mMaxThreads = 1;
+    };
+}
+
+#endif
@@ -76,6 +76,7 @@
 #include "../mwmechanics/recharge.hpp"
 #include "../mwmechanics/spellutil.hpp"
 
+#include "cellrefreader.hpp"
 #include "class.hpp"
 #include "containerstore.hpp"
 #include "esmstore.hpp"
@@ -556,9 +557,11 @@ namespace MWWorld
         return false;
     }
 
-    CellStore::CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& esmStore, ESM::ReadersCache& readers)
+    CellStore::CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& esmStore, ESM::ReadersCache& readers,
+        const CellRefReader& cellRefReader)
         : mStore(esmStore)
         , mReaders(readers)
+        , mCellRefReader(cellRefReader)
         , mCellVariant(std::move(cell))
         , mState(State_Unloaded)
         , mHasState(false)
@@ -808,49 +811,19 @@ namespace MWWorld
         std::sort(mIds.begin(), mIds.end());
     }
 
-    void CellStore::loadRefs(const ESM::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID)
+    void CellStore::loadRefs(const ESM::Cell& cell, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID)
     {
         if (cell.mContextList.empty())
             return; // this is a dynamically generated cell -> skipping.
 
         // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
-        {
-            try
-            {
-                // Reopen the ESM reader and seek to the right position.
-                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                const ESM::ReadersCache::BusyItem reader = mReaders.get(index);
-                cell.restore(*reader, i);
-
-                ESM::CellRef ref;
-                // Get each reference in turn
-                ESM::MovedCellRef cMRef;
-                bool deleted = false;
-                bool moved = false;
-                while (ESM::Cell::getNextRef(
-                    *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                {
-                    if (moved)
-                        continue;
-
-                    // Don't load reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter
-                        = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum);
-                    if (iter != cell.mMovedRefs.end())
-                    {
-                        continue;
-                    }
-
-                    loadRef(ref, deleted, refNumToID);
-                }
-            }
-            catch (std::exception& e)
-            {
+        mCellRefReader.read(
+            cell, [&](ESM::CellRef& ref, bool deleted) { loadRef(ref, deleted, refNumToID); },
+            [&](std::string_view error) {
                 Log(Debug::Error) << "An error occurred loading references for cell " << getCell()->getDescription()
-                                  << ": " << e.what();
-            }
-        }
+                                  << ": " << error;
+            });
+
         // Load moved references, from separately tracked list.
         for (const auto& leasedRef : cell.mLeasedRefs)
         {
@@ -861,7 +834,7 @@ namespace MWWorld
         }
     }
 
-    void CellStore::loadRefs(const ESM4::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID)
+    void CellStore::loadRefs(const ESM4::Cell& cell, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID)
     {
         visitCell4References(cell, mStore, mReaders, [&](const ESM4::Reference& ref) { loadRef(ref); });
         visitCell4ActorReferences(cell, mStore, mReaders, [&](const ESM4::ActorCharacter& ref) { loadRef(ref); });
@@ -869,7 +842,7 @@ namespace MWWorld
 
     void CellStore::loadRefs()
     {
-        std::map<ESM::RefNum, ESM::RefId> refNumToID; // used to detect refID modifications
+        std::unordered_map<ESM::RefNum, ESM::RefId> refNumToID; // used to detect refID modifications
 
         ESM::visit([&](auto&& cell) { loadRefs(cell, refNumToID); }, mCellVariant);
 
@@ -927,7 +900,7 @@ namespace MWWorld
         });
     }
 
-    void CellStore::loadRef(ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, ESM::RefId>& refNumToID)
+    void CellStore::loadRef(ESM::CellRef& ref, bool deleted, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID)
     {
         const MWWorld::ESMStore& store = mStore;
 
@@ -9,6 +9,7 @@
 #include <string_view>
 #include <tuple>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include "cell.hpp"
@@ -81,6 +82,7 @@ namespace ESM4
 
 namespace MWWorld
 {
+    class CellRefReader;
     class ESMStore;
     struct CellStoreImp;
 
@@ -140,7 +142,8 @@ namespace MWWorld
         }
 
         /// @param readerList The readers to use for loading of the cell on-demand.
-        CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers);
+        CellStore(MWWorld::Cell&& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers,
+            const CellRefReader& cellRefReader);
 
         CellStore(const CellStore&) = delete;
 
@@ -343,6 +346,7 @@ namespace MWWorld
 
         const MWWorld::ESMStore& mStore;
         ESM::ReadersCache& mReaders;
+        const CellRefReader& mCellRefReader;
 
         // Even though fog actually belongs to the player and not cells,
         // it makes sense to store it here since we need it once for each cell.
@@ -418,14 +422,14 @@ namespace MWWorld
         void listRefs(const ESM4::Cell& cell);
         void listRefs();
 
-        void loadRefs(const ESM::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID);
-        void loadRefs(const ESM4::Cell& cell, std::map<ESM::RefNum, ESM::RefId>& refNumToID);
+        void loadRefs(const ESM::Cell& cell, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID);
+        void loadRefs(const ESM4::Cell& cell, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID);
 
         void loadRefs();
 
         void loadRef(const ESM4::Reference& ref);
         void loadRef(const ESM4::ActorCharacter& ref);
-        void loadRef(ESM::CellRef& ref, bool deleted, std::map<ESM::RefNum, ESM::RefId>& refNumToID);
+        void loadRef(ESM::CellRef& ref, bool deleted, std::unordered_map<ESM::RefNum, ESM::RefId>& refNumToID);
         ///< Make case-adjustments to \a ref and insert it into the respective container.
         ///
         /// Invalid \a ref objects are silently dropped.
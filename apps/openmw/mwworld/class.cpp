@@ -327,6 +327,13 @@ namespace MWWorld
             models.push_back(model);
     }
 
+    void Class::getSoundsToPreload(const Ptr& ptr, std::vector<ESM::RefId>& sounds) const
+    {
+        ESM::RefId sound = getSound(ptr);
+        if (!sound.empty())
+            sounds.push_back(sound);
+    }
+
     const ESM::RefId& Class::applyEnchantment(
         const MWWorld::ConstPtr& ptr, const ESM::RefId& enchId, int enchCharge, const std::string& newName) const
     {
@@ -57,24 +57,6 @@ namespace
 
         return sum;
     }
-
-    template <typename T>
-    MWWorld::Ptr searchId(MWWorld::CellRefList<T>& list, const ESM::RefId& id, MWWorld::ContainerStore* store)
-    {
-        store->resolve();
-
-        for (MWWorld::LiveCellRef<T>& liveCellRef : list.mList)
-        {
-            if ((liveCellRef.mBase->mId == id) && liveCellRef.mData.getCount())
-            {
-                MWWorld::Ptr ptr(&liveCellRef, nullptr);
-                ptr.setContainerStore(store);
-                return ptr;
-            }
-        }
-
-        return MWWorld::Ptr();
-    }
 }
 
 MWWorld::ResolutionListener::~ResolutionListener()
@@ -106,10 +88,60 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::getState(
     collection.mList.push_back(ref);
     auto it = ContainerStoreIterator(this, --collection.mList.end());
     MWBase::Environment::get().getWorldModel()->registerPtr(*it);
+    addToItemIndex(it);
 
     return it;
 }
 
+template <typename T>
+void MWWorld::ContainerStore::addToItemIndex(CellRefList<T>& collection)
+{
+    for (auto it = collection.mList.begin(); it != collection.mList.end(); ++it)
+        mItemIndex.mItems[it->mRef.getRefId()].emplace_back(this, it);
+}
+
+void MWWorld::ContainerStore::addToItemIndex(const ContainerStoreIterator& iterator)
+{
+    if (mItemIndex.mUpToDate)
+        mItemIndex.mItems[iterator->getCellRef().getRefId()].push_back(iterator);
+}
+
+const std::vector<MWWorld::ContainerStoreIterator>& MWWorld::ContainerStore::getItems(const ESM::RefId& id)
+{
+    if (!mItemIndex.mUpToDate)
+    {
+        mItemIndex.mItems.clear();
+        addToItemIndex(potions);
+        addToItemIndex(appas);
+        addToItemIndex(armors);
+        addToItemIndex(books);
+        addToItemIndex(clothes);
+        addToItemIndex(ingreds);
+        addToItemIndex(lights);
+        addToItemIndex(lockpicks);
+        addToItemIndex(miscItems);
+        addToItemIndex(probes);
+        addToItemIndex(repairs);
+        addToItemIndex(weapons);
+        mItemIndex.mUpToDate = true;
+    }
+
+    static const std::vector<ContainerStoreIterator> empty;
+    const auto it = mItemIndex.mItems.find(id);
+    if (it == mItemIndex.mItems.end())
+        return empty;
+    return it->second;
+}
+
+MWWorld::ContainerStore::ItemIndex::ItemIndex(const ItemIndex&) {}
+
+MWWorld::ContainerStore::ItemIndex& MWWorld::ContainerStore::ItemIndex::operator=(const ItemIndex&)
+{
+    mItems.clear();
+    mUpToDate = false;
+    return *this;
+}
+
 void MWWorld::ContainerStore::storeEquipmentState(
     const MWWorld::LiveCellRefBase& ref, int index, ESM::InventoryState& inventory) const
 {
@@ -190,9 +222,9 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::end()
 int MWWorld::ContainerStore::count(const ESM::RefId& id) const
 {
     int total = 0;
-    for (const auto&& iter : *this)
-        if (iter.getCellRef().getRefId() == id)
-            total += iter.getRefData().getCount();
+    // the index is only a cache of the items, counting doesn't change them
+    for (const ContainerStoreIterator& iter : const_cast<ContainerStore*>(this)->getItems(id))
+        total += iter->getRefData().getCount();
     return total;
 }
 
@@ -241,9 +273,10 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::restack(const MWWorld::
 {
     resolve();
     MWWorld::ContainerStoreIterator retval = end();
-    for (MWWorld::ContainerStoreIterator iter(begin()); iter != end(); ++iter)
+    const std::vector<ContainerStoreIterator>& items = getItems(item.getCellRef().getRefId());
+    for (const MWWorld::ContainerStoreIterator& iter : items)
     {
-        if (item == *iter)
+        if (iter->getRefData().getCount() != 0 && item == *iter)
         {
             retval = iter;
             break;
@@ -253,9 +286,9 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::restack(const MWWorld::
     if (retval == end())
         throw std::runtime_error("item is not from this container");
 
-    for (MWWorld::ContainerStoreIterator iter(begin()); iter != end(); ++iter)
+    for (const MWWorld::ContainerStoreIterator& iter : items)
     {
-        if (stacks(*iter, item))
+        if (iter->getRefData().getCount() != 0 && stacks(*iter, item))
         {
             iter->getRefData().setCount(
                 addItems(iter->getRefData().getCount(false), item.getRefData().getCount(false)));
@@ -378,7 +411,6 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp(const Ptr& ptr,
 {
     if (markModified)
         resolve();
-    int type = getType(ptr);
 
     const MWWorld::ESMStore& esmStore = *MWBase::Environment::get().getESMStore();
 
@@ -389,9 +421,9 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp(const Ptr& ptr,
     {
         int realCount = count * ptr.getClass().getValue(ptr);
 
-        for (MWWorld::ContainerStoreIterator iter(begin(type)); iter != end(); ++iter)
+        for (const MWWorld::ContainerStoreIterator& iter : getItems(MWWorld::ContainerStore::sGoldId))
         {
-            if (iter->getCellRef().getRefId() == MWWorld::ContainerStore::sGoldId)
+            if (iter->getRefData().getCount() != 0)
             {
                 iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), realCount));
                 flagAsModified();
@@ -403,9 +435,12 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp(const Ptr& ptr,
         return addNewStack(ref.getPtr(), realCount);
     }
 
-    // determine whether to stack or not
-    for (MWWorld::ContainerStoreIterator iter(begin(type)); iter != end(); ++iter)
+    // determine whether to stack or not, only items with the same id can stack
+    for (const MWWorld::ContainerStoreIterator& iter : getItems(ptr.getCellRef().getRefId()))
     {
+        if (iter->getRefData().getCount() == 0)
+            continue;
+
         // Don't stack with equipped items
         if (auto* inventoryStore = dynamic_cast<InventoryStore*>(this))
             if (inventoryStore->isEquipped(*iter))
@@ -480,6 +515,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addNewStack(const Const
             break;
     }
 
+    addToItemIndex(it);
     it->getRefData().setCount(count);
 
     flagAsModified();
@@ -534,9 +570,11 @@ int MWWorld::ContainerStore::remove(const ESM::RefId& itemId, int count, bool eq
         resolve();
     int toRemove = count;
 
-    for (ContainerStoreIterator iter(begin()); iter != end() && toRemove > 0; ++iter)
-        if (iter->getCellRef().getRefId() == itemId)
-            toRemove -= remove(*iter, toRemove, equipReplacement, resolveFirst);
+    // removal may add stacks of the same item when unequipping, so iterate over a copy
+    const std::vector<ContainerStoreIterator> items = getItems(itemId);
+    for (auto iter = items.begin(); iter != items.end() && toRemove > 0; ++iter)
+        if ((*iter)->getRefData().getCount() != 0)
+            toRemove -= remove(**iter, toRemove, equipReplacement, resolveFirst);
 
     flagAsModified();
 
@@ -810,18 +848,17 @@ MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const ESM::RefId& id)
 {
     MWWorld::Ptr item;
     int itemHealth = 1;
-    for (auto&& iter : *this)
+    for (const ContainerStoreIterator& iter : getItems(id))
     {
-        int iterHealth = iter.getClass().hasItemHealth(iter) ? iter.getClass().getItemHealth(iter) : 1;
-        if (iter.getCellRef().getRefId() == id)
+        if (iter->getRefData().getCount() == 0)
+            continue;
+        int iterHealth = iter->getClass().hasItemHealth(*iter) ? iter->getClass().getItemHealth(*iter) : 1;
+        // Prefer the stack with the lowest remaining uses
+        // Try to get item with zero durability only if there are no other items found
+        if (item.isEmpty() || (iterHealth > 0 && iterHealth < itemHealth) || (itemHealth <= 0 && iterHealth > 0))
         {
-            // Prefer the stack with the lowest remaining uses
-            // Try to get item with zero durability only if there are no other items found
-            if (item.isEmpty() || (iterHealth > 0 && iterHealth < itemHealth) || (itemHealth <= 0 && iterHealth > 0))
-            {
-                item = iter;
-                itemHealth = iterHealth;
-            }
+            item = *iter;
+            itemHealth = iterHealth;
         }
     }
 
@@ -831,77 +868,9 @@ MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const ESM::RefId& id)
 MWWorld::Ptr MWWorld::ContainerStore::search(const ESM::RefId& id)
 {
     resolve();
-    {
-        Ptr ptr = searchId(potions, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(appas, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(armors, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(books, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(clothes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(ingreds, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(lights, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(lockpicks, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(miscItems, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(probes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(repairs, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId(weapons, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
+    for (const ContainerStoreIterator& iter : getItems(id))
+        if (iter->getRefData().getCount() != 0)
+            return *iter;
 
     return Ptr();
 }
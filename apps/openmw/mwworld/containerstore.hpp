@@ -4,7 +4,9 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <components/esm3/loadalch.hpp>
 #include <components/esm3/loadappa.hpp>
@@ -142,6 +144,20 @@ namespace MWWorld
         mutable float mCachedWeight;
         mutable bool mWeightUpToDate;
 
+        // Items by id including the ones with zero count, built on first use and updated when stacks are added.
+        // Entries refer to the lists of this store, so a copy starts with an empty index.
+        struct ItemIndex
+        {
+            std::unordered_map<ESM::RefId, std::vector<ContainerStoreIterator>> mItems;
+            bool mUpToDate = false;
+
+            ItemIndex() = default;
+            ItemIndex(const ItemIndex&);
+            ItemIndex& operator=(const ItemIndex&);
+        };
+
+        ItemIndex mItemIndex;
+
         bool mModified;
         bool mResolved;
         unsigned int mSeed;
@@ -157,6 +173,14 @@ namespace MWWorld
         template <typename T>
         ContainerStoreIterator getState(CellRefList<T>& collection, const ESM::ObjectState& state);
 
+        template <typename T>
+        void addToItemIndex(CellRefList<T>& collection);
+
+        void addToItemIndex(const ContainerStoreIterator& iterator);
+
+        const std::vector<ContainerStoreIterator>& getItems(const ESM::RefId& id);
+        ///< @return All items with refID \a id, including the ones with zero count
+
         template <typename T>
         void storeState(const LiveCellRef<T>& ref, ESM::ObjectState& state) const;
 
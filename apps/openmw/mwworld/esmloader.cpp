@@ -11,6 +11,7 @@
 #include <components/files/openfile.hpp>
 #include <components/misc/strings/lower.hpp>
 #include <components/resource/resourcesystem.hpp>
+#include <components/settings/values.hpp>
 
 #include "../mwbase/environment.hpp"
 
@@ -68,6 +69,7 @@ namespace MWWorld
                     MWBase::Environment::get().getResourceSystem()->getVFS(), mReaders.getStatelessEncoder());
                 readerESM4.setModIndex(index);
                 readerESM4.updateModIndices(mNameToIndex);
+                readerESM4.prefetchCompressedRecords(Settings::general().mEsm4DecompressionThreads);
                 mStore.loadESM4(readerESM4);
                 break;
             }
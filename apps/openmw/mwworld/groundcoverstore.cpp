@@ -1,5 +1,6 @@
 #include "groundcoverstore.hpp"
 
+#include <components/debug/debuglog.hpp>
 #include <components/esm3/loadcell.hpp>
 #include <components/esm3/loadstat.hpp>
 #include <components/esm3/readerscache.hpp>
@@ -8,15 +9,101 @@
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/strings/lower.hpp>
 #include <components/resource/resourcesystem.hpp>
+#include <components/sceneutil/workqueue.hpp>
+#include <components/settings/values.hpp>
+#include <components/to_utf8/to_utf8.hpp>
 
 #include <apps/openmw/mwbase/environment.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+
 #include "store.hpp"
 
 namespace MWWorld
 {
+    namespace
+    {
+        class DensityCalculator
+        {
+        public:
+            DensityCalculator(float density)
+                : mDensity(density)
+            {
+            }
+
+            bool isInstanceEnabled()
+            {
+                if (mDensity >= 1.f)
+                    return true;
+
+                mCurrentGroundcover += mDensity;
+                if (mCurrentGroundcover < 1.f)
+                    return false;
+
+                mCurrentGroundcover -= 1.f;
+
+                return true;
+            }
+
+        private:
+            float mCurrentGroundcover = 0.f;
+            float mDensity = 0.f;
+        };
+
+        using ModelIndices = std::unordered_map<ESM::RefId, std::uint32_t>;
+
+        std::vector<GroundcoverInstance> loadInstances(const std::vector<ESM::ESM_Context>& contexts,
+            const ModelIndices& models, float density, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder)
+        {
+            ESM::Cell cell;
+            cell.blank();
+            cell.mContextList = contexts;
+
+            DensityCalculator calculator(density);
+            std::map<ESM::RefNum, ESM::CellRef> refs;
+            for (size_t i = 0; i < cell.mContextList.size(); ++i)
+            {
+                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                reader->setEncoder(encoder);
+                cell.restore(*reader, i);
+                ESM::CellRef ref;
+                bool deleted = false;
+                while (cell.getNextRef(*reader, ref, deleted))
+                {
+                    if (!deleted && refs.find(ref.mRefNum) == refs.end() && !calculator.isInstanceEnabled())
+                        deleted = true;
+
+                    if (deleted)
+                    {
+                        refs.erase(ref.mRefNum);
+                        continue;
+                    }
+                    refs[ref.mRefNum] = std::move(ref);
+                }
+            }
+
+            std::vector<GroundcoverInstance> result;
+            result.reserve(refs.size());
+            for (const auto& [refNum, ref] : refs)
+            {
+                const auto model = models.find(ref.mRefID);
+                if (model != models.end())
+                    result.push_back(GroundcoverInstance{ ref.mPos, ref.mScale, model->second });
+            }
+
+            std::stable_sort(result.begin(), result.end(),
+                [](const GroundcoverInstance& l, const GroundcoverInstance& r) { return l.mModel < r.mModel; });
+
+            return result;
+        }
+    }
+
     void GroundcoverStore::init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
-        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, SceneUtil::WorkQueue* workQueue,
+        Loading::Listener* listener)
     {
         ::EsmLoader::Query query;
         query.mLoadStatics = true;
@@ -28,6 +115,7 @@ namespace MWWorld
 
         const VFS::Manager* const vfs = MWBase::Environment::get().getResourceSystem()->getVFS();
 
+        std::map<ESM::RefId, std::string> meshCache;
         static constexpr std::string_view prefix = "grass\\";
         for (const ESM::Static& stat : statics)
         {
@@ -35,7 +123,7 @@ namespace MWWorld
             std::replace(model.begin(), model.end(), '/', '\\');
             if (!model.starts_with(prefix))
                 continue;
-            mMeshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model, vfs);
+            meshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model, vfs);
         }
 
         for (const ESM::Static& stat : content.mStatics)
@@ -44,33 +132,67 @@ namespace MWWorld
             std::replace(model.begin(), model.end(), '/', '\\');
             if (!model.starts_with(prefix))
                 continue;
-            mMeshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model, vfs);
+            meshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model, vfs);
+        }
+
+        ModelIndices models;
+        std::map<std::string_view, std::uint32_t> modelIndices;
+        for (const auto& [id, model] : meshCache)
+        {
+            const auto [it, inserted] = modelIndices.emplace(model, static_cast<std::uint32_t>(mModels.size()));
+            if (inserted)
+                mModels.push_back(model);
+            models.emplace(id, it->second);
         }
 
+        std::vector<std::pair<std::pair<int, int>, const ESM::Cell*>> cells;
         for (const ESM::Cell& cell : content.mCells)
         {
             if (!cell.isExterior())
                 continue;
-            auto cellIndex = std::make_pair(cell.getGridX(), cell.getGridY());
-            mCellContexts[cellIndex] = std::move(cell.mContextList);
+            cells.emplace_back(std::make_pair(cell.getGridX(), cell.getGridY()), &cell);
         }
-    }
 
-    std::string GroundcoverStore::getGroundcoverModel(const ESM::RefId& id) const
-    {
-        auto search = mMeshCache.find(id);
-        if (search == mMeshCache.end())
-            return std::string();
+        const float density = Settings::groundcover().mDensity;
+        if (density <= 0.f)
+            return;
 
-        return search->second;
+        // Cells are independent, they are split into a part per thread of the work queue and the calling one. Every
+        // part is read with its own readers and encoder, as these are not thread safe.
+        const std::size_t numParts = std::min(
+            workQueue != nullptr ? workQueue->getNumThreads() + 1 : 1, std::max<std::size_t>(cells.size(), 1));
+        std::vector<std::vector<GroundcoverInstance>> instances(cells.size());
+        const auto loadCells = [&](std::size_t part) {
+            ESM::ReadersCache partReaders;
+            std::optional<ToUTF8::Utf8Encoder> partEncoder;
+            if (encoder != nullptr)
+                partEncoder.emplace(encoder->getStatelessEncoder());
+            for (std::size_t i = part; i < cells.size(); i += numParts)
+                instances[i] = loadInstances(cells[i].second->mContextList, models, density, partReaders,
+                    partEncoder.has_value() ? &*partEncoder : nullptr);
+        };
+
+        SceneUtil::parallelFor(workQueue, numParts, loadCells);
+
+        std::size_t numInstances = 0;
+        for (std::size_t i = 0; i < cells.size(); ++i)
+        {
+            if (instances[i].empty())
+                continue;
+            numInstances += instances[i].size();
+            mCellInstances[cells[i].first] = std::move(instances[i]);
+        }
+
+        Log(Debug::Info) << "Prepared " << numInstances << " groundcover instances in " << mCellInstances.size()
+                         << " cells";
     }
 
-    void GroundcoverStore::initCell(ESM::Cell& cell, int cellX, int cellY) const
+    std::span<const GroundcoverInstance> GroundcoverStore::getInstances(int cellX, int cellY) const
     {
-        cell.blank();
+        auto search = mCellInstances.find(std::make_pair(cellX, cellY));
+        if (search == mCellInstances.end())
+            return {};
 
-        auto searchCell = mCellContexts.find(std::make_pair(cellX, cellY));
-        if (searchCell != mCellContexts.end())
-            cell.mContextList = searchCell->second;
+        return search->second;
     }
 }
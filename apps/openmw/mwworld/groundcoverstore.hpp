@@ -1,16 +1,18 @@
 #ifndef GAME_MWWORLD_GROUNDCOVER_STORE_H
 #define GAME_MWWORLD_GROUNDCOVER_STORE_H
 
+#include <components/esm/defs.hpp>
 #include <components/esm/refid.hpp>
+
+#include <cstdint>
 #include <map>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace ESM
 {
-    struct ESM_Context;
     struct Static;
-    struct Cell;
 }
 
 namespace Loading
@@ -28,24 +30,38 @@ namespace ToUTF8
     class Utf8Encoder;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWWorld
 {
     template <class T>
     class Store;
 
+    struct GroundcoverInstance
+    {
+        ESM::Position mPos;
+        float mScale;
+        // index of the model in GroundcoverStore
+        std::uint32_t mModel;
+    };
+
     class GroundcoverStore
     {
     private:
-        std::map<ESM::RefId, std::string> mMeshCache;
-        std::map<std::pair<int, int>, std::vector<ESM::ESM_Context>> mCellContexts;
+        std::vector<std::string> mModels;
+        // instances of every exterior cell left after applying the density, ordered by model
+        std::map<std::pair<int, int>, std::vector<GroundcoverInstance>> mCellInstances;
 
     public:
         void init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
-            Loading::Listener* listener);
+            SceneUtil::WorkQueue* workQueue, Loading::Listener* listener);
 
-        std::string getGroundcoverModel(const ESM::RefId& id) const;
-        void initCell(ESM::Cell& cell, int cellX, int cellY) const;
+        const std::string& getModel(std::uint32_t index) const { return mModels[index]; }
+        std::span<const GroundcoverInstance> getInstances(int cellX, int cellY) const;
     };
 }
 
@@ -52,6 +52,7 @@
 
 #include "../mwsound/sound.hpp"
 
+#include "../mwphysics/actor.hpp"
 #include "../mwphysics/physicssystem.hpp"
 #include "../mwphysics/projectile.hpp"
 
@@ -393,6 +394,43 @@ namespace MWWorld
         periodicCleanup(dt);
         moveProjectiles(dt);
         moveMagicBolts(dt);
+
+        mCasters.clear();
+        mValidTargets.clear();
+    }
+
+    MWWorld::Ptr ProjectileManager::getCaster(State& state)
+    {
+        if (!state.mCasterHandle.isEmpty())
+            return state.mCasterHandle;
+
+        auto it = mCasters.find(state.mActorId);
+        if (it == mCasters.end())
+            it = mCasters.emplace(state.mActorId, state.getCaster()).first;
+        return it->second;
+    }
+
+    const std::vector<const btCollisionObject*>& ProjectileManager::getValidTargets(const MWWorld::Ptr& caster)
+    {
+        static const std::vector<const btCollisionObject*> noTargets;
+
+        // For AI actors, get combat targets to use in the ray cast. Only those targets will return a positive hit
+        // result.
+        if (caster.isEmpty() || !caster.getClass().isActor() || caster == MWMechanics::getPlayer())
+            return noTargets;
+
+        const auto [it, inserted] = mValidTargets.try_emplace(caster.mRef);
+        if (inserted)
+        {
+            std::vector<MWWorld::Ptr> targetActors;
+            caster.getClass().getCreatureStats(caster).getAiSequence().getCombatTargets(targetActors);
+            for (const MWWorld::Ptr& target : targetActors)
+            {
+                if (const MWPhysics::Actor* physicActor = mPhysics->getActor(target))
+                    it->second.push_back(physicActor->getCollisionObject());
+            }
+        }
+        return it->second;
     }
 
     void ProjectileManager::periodicCleanup(float dt)
@@ -434,7 +472,7 @@ namespace MWWorld
             if (!projectile->isActive())
                 continue;
             // If the actor caster is gone, the magic bolt needs to be removed from the scene during the next frame.
-            MWWorld::Ptr caster = magicBoltState.getCaster();
+            MWWorld::Ptr caster = getCaster(magicBoltState);
             if (!caster.isEmpty() && caster.getClass().isActor())
             {
                 if (caster.getRefData().getCount() <= 0 || caster.getClass().getCreatureStats(caster).isDead())
@@ -461,12 +499,7 @@ namespace MWWorld
 
             update(magicBoltState, duration);
 
-            // For AI actors, get combat targets to use in the ray cast. Only those targets will return a positive hit
-            // result.
-            std::vector<MWWorld::Ptr> targetActors;
-            if (!caster.isEmpty() && caster.getClass().isActor() && caster != MWMechanics::getPlayer())
-                caster.getClass().getCreatureStats(caster).getAiSequence().getCombatTargets(targetActors);
-            projectile->setValidTargets(targetActors);
+            projectile->setValidTargets(getValidTargets(caster));
         }
     }
 
@@ -498,14 +531,7 @@ namespace MWWorld
 
             update(projectileState, duration);
 
-            MWWorld::Ptr caster = projectileState.getCaster();
-
-            // For AI actors, get combat targets to use in the ray cast. Only those targets will return a positive hit
-            // result.
-            std::vector<MWWorld::Ptr> targetActors;
-            if (!caster.isEmpty() && caster.getClass().isActor() && caster != MWMechanics::getPlayer())
-                caster.getClass().getCreatureStats(caster).getAiSequence().getCombatTargets(targetActors);
-            projectile->setValidTargets(targetActors);
+            projectile->setValidTargets(getValidTargets(getCaster(projectileState)));
         }
     }
 
@@ -2,6 +2,8 @@
 #define OPENMW_MWWORLD_PROJECTILEMANAGER_H
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <osg/PositionAttitudeTransform>
 #include <osg/ref_ptr>
@@ -12,6 +14,8 @@
 
 #include "ptr.hpp"
 
+class btCollisionObject;
+
 namespace MWPhysics
 {
     class PhysicsSystem;
@@ -128,6 +132,14 @@ namespace MWWorld
         std::vector<MagicBoltState> mMagicBolts;
         std::vector<ProjectileState> mProjectiles;
 
+        // Projectiles in flight usually share a few casters, so casters and their targets are looked up once per
+        // update instead of once per projectile.
+        std::unordered_map<int, MWWorld::Ptr> mCasters;
+        std::unordered_map<const MWWorld::LiveCellRefBase*, std::vector<const btCollisionObject*>> mValidTargets;
+
+        MWWorld::Ptr getCaster(State& state);
+        const std::vector<const btCollisionObject*>& getValidTargets(const MWWorld::Ptr& caster);
+
         void cleanupProjectile(ProjectileState& state);
         void cleanupMagicBolt(MagicBoltState& state);
         void periodicCleanup(float dt);
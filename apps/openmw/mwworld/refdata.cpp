@@ -35,7 +35,7 @@ namespace MWWorld
     void RefData::copy(const RefData& refData)
     {
         mBaseNode = refData.mBaseNode;
-        mLocals = refData.mLocals;
+        mScriptedState = refData.mScriptedState ? std::make_unique<ScriptedState>(*refData.mScriptedState) : nullptr;
         mEnabled = refData.mEnabled;
         mCount = refData.mCount;
         mPosition = refData.mPosition;
@@ -44,8 +44,6 @@ namespace MWWorld
         mFlags = refData.mFlags;
         mPhysicsPostponed = refData.mPhysicsPostponed;
 
-        mAnimationState = refData.mAnimationState;
-
         mCustomData = refData.mCustomData ? refData.mCustomData->clone() : nullptr;
         mLuaScripts = refData.mLuaScripts;
     }
@@ -120,11 +118,13 @@ namespace MWWorld
         , mPhysicsPostponed(false)
         , mCount(objectState.mCount)
         , mPosition(objectState.mPosition)
-        , mAnimationState(objectState.mAnimationState)
         , mCustomData(nullptr)
         , mChanged(true)
         , mFlags(objectState.mFlags) // Loading from a savegame -> assume changed
     {
+        if (!objectState.mAnimationState.empty())
+            getScriptedState().mAnimationState = objectState.mAnimationState;
+
         // "Note that the ActivationFlag_UseEnabled is saved to the reference,
         // which will result in permanently suppressed activation if the reference script is removed.
         // This occurred when removing the animated containers mod, and the fix in MCP is to reset UseEnabled to true on
@@ -150,14 +150,16 @@ namespace MWWorld
 
     void RefData::write(ESM::ObjectState& objectState, const ESM::RefId& scriptId) const
     {
-        objectState.mHasLocals = mLocals.write(objectState.mLocals, scriptId);
+        objectState.mHasLocals
+            = mScriptedState != nullptr && mScriptedState->mLocals.write(objectState.mLocals, scriptId);
 
         objectState.mEnabled = mEnabled;
         objectState.mCount = mCount;
         objectState.mPosition = mPosition;
         objectState.mFlags = mFlags;
 
-        objectState.mAnimationState = mAnimationState;
+        objectState.mAnimationState
+            = mScriptedState != nullptr ? mScriptedState->mAnimationState : ESM::AnimationState();
     }
 
     RefData& RefData::operator=(const RefData& refData)
@@ -212,9 +214,17 @@ namespace MWWorld
         return mCount;
     }
 
+    RefData::ScriptedState& RefData::getScriptedState()
+    {
+        if (mScriptedState == nullptr)
+            mScriptedState = std::make_unique<ScriptedState>();
+        return *mScriptedState;
+    }
+
     void RefData::setLocals(const ESM::Script& script)
     {
-        if (mLocals.configure(script) && !mLocals.isEmpty())
+        MWScript::Locals& locals = getScriptedState().mLocals;
+        if (locals.configure(script) && !locals.isEmpty())
             mChanged = true;
     }
 
@@ -245,7 +255,7 @@ namespace MWWorld
 
     MWScript::Locals& RefData::getLocals()
     {
-        return mLocals;
+        return getScriptedState().mLocals;
     }
 
     bool RefData::isEnabled() const
@@ -300,7 +310,7 @@ namespace MWWorld
 
     bool RefData::hasChanged() const
     {
-        return mChanged || !mAnimationState.empty();
+        return mChanged || (mScriptedState != nullptr && !mScriptedState->mAnimationState.empty());
     }
 
     bool RefData::activateByScript()
@@ -333,12 +343,15 @@ namespace MWWorld
 
     const ESM::AnimationState& RefData::getAnimationState() const
     {
-        return mAnimationState;
+        static const ESM::AnimationState emptyState;
+        if (mScriptedState == nullptr)
+            return emptyState;
+        return mScriptedState->mAnimationState;
     }
 
     ESM::AnimationState& RefData::getAnimationState()
     {
-        return mAnimationState;
+        return getScriptedState().mAnimationState;
     }
 
 }
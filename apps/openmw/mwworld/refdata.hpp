@@ -43,9 +43,17 @@ namespace MWWorld
 
     class RefData
     {
+        // Most references are plain statics without a script or scripted animations, so this state is allocated
+        // only for the references using it
+        struct ScriptedState
+        {
+            MWScript::Locals mLocals;
+            ESM::AnimationState mAnimationState;
+        };
+
         osg::ref_ptr<SceneUtil::PositionAttitudeTransform> mBaseNode;
 
-        MWScript::Locals mLocals;
+        std::unique_ptr<ScriptedState> mScriptedState;
         std::shared_ptr<MWLua::LocalScripts> mLuaScripts;
 
         /// separate delete flag used for deletion by a content file
@@ -63,10 +71,10 @@ namespace MWWorld
 
         ESM::Position mPosition;
 
-        ESM::AnimationState mAnimationState;
-
         std::unique_ptr<CustomData> mCustomData;
 
+        ScriptedState& getScriptedState();
+
         void copy(const RefData& refData);
 
         void cleanup();
@@ -46,6 +46,7 @@
 #include "esmstore.hpp"
 #include "localscripts.hpp"
 #include "player.hpp"
+#include "streamedobjects.hpp"
 #include "worldimp.hpp"
 
 namespace
@@ -306,10 +307,13 @@ namespace MWWorld
         if (mChangeCellGridRequest.has_value())
         {
             changeCellGrid(mChangeCellGridRequest->mPosition, mChangeCellGridRequest->mCellIndex,
-                mChangeCellGridRequest->mChangeEvent);
+                mChangeCellGridRequest->mChangeEvent, mStreamingBudget > 0);
             mChangeCellGridRequest.reset();
         }
 
+        if (!mStreamedObjects.empty())
+            insertStreamedObjects();
+
         mPreloader->updateCache(mRendering.getReferenceTime());
         preloadCells(duration);
     }
@@ -320,6 +324,9 @@ namespace MWWorld
             return;
         Log(Debug::Info) << "Unloading cell " << cell->getCell()->getDescription();
 
+        if (std::erase_if(mStreamedObjects, [&](const Ptr& ptr) { return ptr.getCell() == cell; }) > 0)
+            mPreloader->notifyLoaded(cell);
+
         ListAndResetObjectsVisitor visitor;
 
         cell->forEach(visitor);
@@ -377,7 +384,7 @@ namespace MWWorld
     }
 
     void Scene::loadCell(CellStore& cell, Loading::Listener* loadingListener, bool respawn, const osg::Vec3f& position,
-        const DetourNavigator::UpdateGuard* navigatorUpdateGuard)
+        const DetourNavigator::UpdateGuard* navigatorUpdateGuard, bool streamObjects)
     {
         using DetourNavigator::HeightfieldShape;
 
@@ -451,7 +458,17 @@ namespace MWWorld
         if (respawn)
             cell.respawn();
 
-        insertCell(cell, loadingListener, navigatorUpdateGuard);
+        bool streamed = false;
+        if (streamObjects)
+        {
+            InsertVisitor insertVisitor(cell, nullptr);
+            cell.forEach(insertVisitor);
+            mStreamedObjects.insert(
+                mStreamedObjects.end(), insertVisitor.mToInsert.begin(), insertVisitor.mToInsert.end());
+            streamed = !insertVisitor.mToInsert.empty();
+        }
+        else
+            insertCell(cell, loadingListener, navigatorUpdateGuard);
 
         mRendering.addCell(&cell);
 
@@ -482,7 +499,9 @@ namespace MWWorld
         if (!cell.isExterior() && !cellVariant.isQuasiExterior())
             mRendering.configureAmbient(cellVariant);
 
-        mPreloader->notifyLoaded(&cell);
+        // Keep the preloaded models and shapes until the streamed objects are inserted
+        if (!streamed)
+            mPreloader->notifyLoaded(&cell);
     }
 
     void Scene::clear()
@@ -540,7 +559,8 @@ namespace MWWorld
             ESM::ExteriorCellLocation(cell.x(), cell.y(), mCurrentCell->getCell()->getWorldSpace()), changeEvent };
     }
 
-    void Scene::changeCellGrid(const osg::Vec3f& pos, ESM::ExteriorCellLocation playerCellIndex, bool changeEvent)
+    void Scene::changeCellGrid(
+        const osg::Vec3f& pos, ESM::ExteriorCellLocation playerCellIndex, bool changeEvent, bool streamObjects)
     {
         mHalfGridSize
             = isEsm4Ext(playerCellIndex.mWorldspace) ? Constants::ESM4CellGridRadius : Constants::CellGridRadius;
@@ -623,7 +643,9 @@ namespace MWWorld
             if (!isCellInCollection(indexToLoad, mActiveCells))
             {
                 CellStore& cell = mWorld.getWorldModel().getExterior(indexToLoad);
-                loadCell(cell, loadingListener, changeEvent, pos, navigatorUpdateGuard.get());
+                // The player cell is always loaded at once to not leave the player without collisions
+                loadCell(cell, loadingListener, changeEvent, pos, navigatorUpdateGuard.get(),
+                    streamObjects && getDistanceToPlayerCell({ x, y }) > 0);
             }
         }
 
@@ -830,6 +852,7 @@ namespace MWWorld
         , mPreloadDoors(Settings::cells().mPreloadDoors)
         , mPreloadFastTravel(Settings::cells().mPreloadFastTravel)
         , mPredictionTime(Settings::cells().mPredictionTime)
+        , mStreamingBudget(Settings::cells().mStreamingBudget)
     {
         mPreloader = std::make_unique<CellPreloader>(rendering.getResourceSystem(), physics->getShapeManager(),
             rendering.getTerrain(), rendering.getLandManager());
@@ -968,6 +991,57 @@ namespace MWWorld
             [&](const MWWorld::Ptr& ptr) { addObject(ptr, mWorld, *mPhysics, mNavigator, navigatorUpdateGuard); });
     }
 
+    void Scene::insertStreamedObjects()
+    {
+        const auto deadline = std::chrono::steady_clock::now()
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<float, std::milli>(mStreamingBudget));
+
+        std::vector<Ptr> inserted;
+        std::vector<CellStore*> finished;
+        do
+        {
+            const Ptr ptr = mStreamedObjects.front();
+            mStreamedObjects.pop_front();
+
+            // Objects of a cell are queued together, so the cell is done when the next object is from another one
+            if (mStreamedObjects.empty() || mStreamedObjects.front().getCell() != ptr.getCell())
+                finished.push_back(ptr.getCell());
+
+            // The object could be disabled or added to the scene by a script in the meantime
+            if (ptr.getRefData().isDeleted() || !ptr.getRefData().isEnabled() || ptr.getRefData().getBaseNode())
+                continue;
+
+            try
+            {
+                addObject(ptr, mWorld, mPagedRefs, *mPhysics, mRendering);
+                inserted.push_back(ptr);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "failed to render '" << ptr.getCellRef().getRefId() << "': " << e.what();
+            }
+        } while (!mStreamedObjects.empty() && std::chrono::steady_clock::now() < deadline);
+
+        // Like in insertCell, navigator shapes of doors depend on the physics objects around them
+        auto navigatorUpdateGuard = mNavigator.makeUpdateGuard();
+        for (const Ptr& ptr : inserted)
+        {
+            try
+            {
+                addObject(ptr, mWorld, *mPhysics, mNavigator, navigatorUpdateGuard.get());
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "failed to render '" << ptr.getCellRef().getRefId() << "': " << e.what();
+            }
+        }
+        mNavigator.update(mWorld.getPlayerPtr().getRefData().getPosition().asVec3(), navigatorUpdateGuard.get());
+
+        for (CellStore* cell : finished)
+            mPreloader->notifyLoaded(cell);
+    }
+
     void Scene::addObjectToScene(const Ptr& ptr)
     {
         try
@@ -984,6 +1058,7 @@ namespace MWWorld
 
     void Scene::removeObjectFromScene(const Ptr& ptr, bool keepActive)
     {
+        removeStreamedObject(ptr);
         MWBase::Environment::get().getMechanicsManager()->remove(ptr, keepActive);
         // You'd expect the sounds attached to the object to be stopped here
         // because the object is nowhere to be heard, but in Morrowind, they're not.
@@ -1007,6 +1082,16 @@ namespace MWWorld
         ptr.getRefData().setBaseNode(nullptr);
     }
 
+    bool Scene::removeStreamedObject(const Ptr& ptr)
+    {
+        if (mStreamedObjects.empty())
+            return false;
+        const RemovedStreamedObject<Ptr> removed = MWWorld::removeStreamedObject(mStreamedObjects, ptr);
+        if (removed.mLastOfCell)
+            mPreloader->notifyLoaded(removed.mObject->getCell());
+        return removed.mObject.has_value();
+    }
+
     bool Scene::isCellActive(const CellStore& cell)
     {
         return mActiveCells.contains(&cell);
@@ -7,6 +7,7 @@
 
 #include "ptr.hpp"
 
+#include <deque>
 #include <memory>
 #include <optional>
 #include <set>
@@ -101,6 +102,7 @@ namespace MWWorld
         bool mPreloadDoors;
         bool mPreloadFastTravel;
         float mPredictionTime;
+        float mStreamingBudget;
 
         int mHalfGridSize = Constants::CellGridRadius;
 
@@ -112,13 +114,21 @@ namespace MWWorld
 
         std::optional<ChangeCellGridRequest> mChangeCellGridRequest;
 
+        // Objects of the loaded cells which are not added to the scene yet, grouped by cell, nearest cells first
+        std::deque<Ptr> mStreamedObjects;
+
         void insertCell(CellStore& cell, Loading::Listener* loadingListener,
             const DetourNavigator::UpdateGuard* navigatorUpdateGuard);
 
+        // Add streamed objects to the scene until the per frame time budget is spent
+        void insertStreamedObjects();
+
         osg::Vec2i mCurrentGridCenter;
 
         // Load and unload cells as necessary to create a cell grid with "X" and "Y" in the center
-        void changeCellGrid(const osg::Vec3f& pos, ESM::ExteriorCellLocation playerCellIndex, bool changeEvent = true);
+        /// @param streamObjects Add objects of the loaded cells other than the player cell over the next frames?
+        void changeCellGrid(const osg::Vec3f& pos, ESM::ExteriorCellLocation playerCellIndex, bool changeEvent = true,
+            bool streamObjects = false);
 
         void requestChangeCellGrid(const osg::Vec3f& position, const osg::Vec2i& cell, bool changeEvent = true);
 
@@ -136,7 +146,7 @@ namespace MWWorld
 
         void unloadCell(CellStore* cell, const DetourNavigator::UpdateGuard* navigatorUpdateGuard);
         void loadCell(CellStore& cell, Loading::Listener* loadingListener, bool respawn, const osg::Vec3f& position,
-            const DetourNavigator::UpdateGuard* navigatorUpdateGuard);
+            const DetourNavigator::UpdateGuard* navigatorUpdateGuard, bool streamObjects = false);
 
     public:
         Scene(MWWorld::World& world, MWRender::RenderingManager& rendering, MWPhysics::PhysicsSystem* physics,
@@ -186,6 +196,10 @@ namespace MWWorld
         void removeObjectFromScene(const Ptr& ptr, bool keepActive = false);
         ///< Remove an object from the scene, but not from the world model.
 
+        bool removeStreamedObject(const Ptr& ptr);
+        ///< Stop adding an object of a loaded cell to the scene over the next frames.
+        /// @return Was the object still queued?
+
         void addPostponedPhysicsObjects();
 
         void removeFromPagedRefs(const Ptr& ptr);
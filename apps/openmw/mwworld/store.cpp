@@ -1087,6 +1087,26 @@ namespace MWWorld
             .mWerewolfValue = getGMSTFloat(settings, "fWerewolfLuck") });
     }
 
+    // Sound generator
+    //=========================================================================
+
+    void Store<ESM::SoundGenerator>::setUp()
+    {
+        TypedDynamicStore<ESM::SoundGenerator>::setUp();
+        mCreatureIndex.clear();
+        for (const ESM::SoundGenerator* sound : mShared)
+            mCreatureIndex[sound->mCreature].push_back(sound);
+    }
+
+    std::span<const ESM::SoundGenerator* const> Store<ESM::SoundGenerator>::getByCreature(
+        const ESM::RefId& creature) const
+    {
+        const auto it = mCreatureIndex.find(creature);
+        if (it == mCreatureIndex.end())
+            return {};
+        return it->second;
+    }
+
     // Dialogue
     //=========================================================================
 
@@ -1111,6 +1131,10 @@ namespace MWWorld
         std::sort(mShared.begin(), mShared.end(),
             [](const ESM::Dialogue* l, const ESM::Dialogue* r) -> bool { return l->mId < r->mId; });
 
+        mInfoIndices.clear();
+        for (const ESM::Dialogue* dial : mShared)
+            mInfoIndices.emplace(dial, *dial);
+
         mKeywordSearchModFlag = true;
     }
 
@@ -1177,6 +1201,9 @@ namespace MWWorld
 
     bool Store<ESM::Dialogue>::eraseStatic(const ESM::RefId& id)
     {
+        if (const auto it = mStatic.find(id); it != mStatic.end())
+            mInfoIndices.erase(&it->second);
+
         if (eraseFromMap(mStatic, id))
             mKeywordSearchModFlag = true;
 
@@ -1211,6 +1238,14 @@ namespace MWWorld
         return mKeywordSearch;
     }
 
+    const MWDialogue::InfoIndex* Store<ESM::Dialogue>::searchInfoIndex(const ESM::Dialogue& dialogue) const
+    {
+        const auto it = mInfoIndices.find(&dialogue);
+        if (it == mInfoIndices.end())
+            return nullptr;
+        return &it->second;
+    }
+
     // ESM4 Cell
     //=========================================================================
 
@@ -19,6 +19,7 @@
 #include <components/esm3/loadland.hpp>
 #include <components/esm3/loadpgrd.hpp>
 #include <components/esm3/loadskil.hpp>
+#include <components/esm3/loadsndg.hpp>
 #include <components/esm4/loadachr.hpp>
 #include <components/esm4/loadcell.hpp>
 #include <components/esm4/loadland.hpp>
@@ -26,6 +27,7 @@
 #include <components/misc/rng.hpp>
 #include <components/misc/strings/algorithm.hpp>
 
+#include "../mwdialogue/infoindex.hpp"
 #include "../mwdialogue/keywordsearch.hpp"
 
 namespace ESM
@@ -502,6 +504,19 @@ namespace MWWorld
         void setUp(const MWWorld::Store<ESM::GameSetting>& settings);
     };
 
+    template <>
+    class Store<ESM::SoundGenerator> : public TypedDynamicStore<ESM::SoundGenerator>
+    {
+    public:
+        void setUp() override;
+
+        /// Returns the sound generators of the creature in the order they are defined by the content files.
+        std::span<const ESM::SoundGenerator* const> getByCreature(const ESM::RefId& creature) const;
+
+    private:
+        std::unordered_map<ESM::RefId, std::vector<const ESM::SoundGenerator*>> mCreatureIndex;
+    };
+
     template <>
     class Store<ESM::WeaponType> : public DynamicStore
     {
@@ -542,6 +557,8 @@ namespace MWWorld
         mutable bool mKeywordSearchModFlag;
         mutable MWDialogue::KeywordSearch<int /*unused*/> mKeywordSearch;
 
+        std::unordered_map<const ESM::Dialogue*, MWDialogue::InfoIndex> mInfoIndices;
+
     public:
         Store();
 
@@ -564,6 +581,9 @@ namespace MWWorld
         void listIdentifier(std::vector<ESM::RefId>& list) const override;
 
         const MWDialogue::KeywordSearch<int>& getDialogIdKeywordSearch() const;
+
+        const MWDialogue::InfoIndex* searchInfoIndex(const ESM::Dialogue& dialogue) const;
+        ///< Return nullptr if the dialogue is not a part of the store or the store is not set up.
     };
 
     template <typename T>
@@ -0,0 +1,37 @@
+#ifndef GAME_MWWORLD_STREAMEDOBJECTS_H
+#define GAME_MWWORLD_STREAMEDOBJECTS_H
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace MWWorld
+{
+    template <class T>
+    struct RemovedStreamedObject
+    {
+        // The queued object, its cell may differ from the cell of the object used to find it
+        std::optional<T> mObject;
+        // No other objects of the same cell are queued
+        bool mLastOfCell = false;
+    };
+
+    // Objects are queued grouped by cell
+    template <class T>
+    RemovedStreamedObject<T> removeStreamedObject(std::deque<T>& objects, const T& object)
+    {
+        const auto it = std::find(objects.begin(), objects.end(), object);
+        if (it == objects.end())
+            return RemovedStreamedObject<T>{};
+        T removed = *it;
+        const auto cell = removed.getCell();
+        const auto next = objects.erase(it);
+        const bool lastOfCell = (next == objects.end() || next->getCell() != cell)
+            && (next == objects.begin() || std::prev(next)->getCell() != cell);
+        return RemovedStreamedObject<T>{ .mObject = std::move(removed), .mLastOfCell = lastOfCell };
+    }
+}
+
+#endif
@@ -247,8 +247,9 @@ namespace MWWorld
     World::World(Resource::ResourceSystem* resourceSystem, int activationDistanceOverride, const std::string& startCell,
         const std::filesystem::path& userDataPath)
         : mResourceSystem(resourceSystem)
+        , mCellRefReader(mReaders)
         , mLocalScripts(mStore)
-        , mWorldModel(mStore, mReaders)
+        , mWorldModel(mStore, mReaders, mCellRefReader)
         , mTimeManager(std::make_unique<DateTimeManager>())
         , mSky(true)
         , mGodMode(false)
@@ -270,7 +271,8 @@ namespace MWWorld
     }
 
     void World::loadData(const Files::Collections& fileCollections, const std::vector<std::string>& contentFiles,
-        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, SceneUtil::WorkQueue* workQueue,
+        Loading::Listener* listener)
     {
         mContentFiles = contentFiles;
         if (encoder)
@@ -278,7 +280,7 @@ namespace MWWorld
         mESMVersions.resize(mContentFiles.size(), -1);
 
         loadContentFiles(fileCollections, contentFiles, encoder, listener);
-        loadGroundcoverFiles(fileCollections, groundcoverFiles, encoder, listener);
+        loadGroundcoverFiles(fileCollections, groundcoverFiles, encoder, workQueue, listener);
 
         fillGlobalVariables();
 
@@ -292,6 +294,8 @@ namespace MWWorld
     void World::init(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, SceneUtil::WorkQueue* workQueue,
         SceneUtil::UnrefQueue& unrefQueue)
     {
+        mCellRefReader.setWorkQueue(workQueue, static_cast<std::size_t>(Settings::cells().mReferenceLoadingThreads));
+
         mPhysics = std::make_unique<MWPhysics::PhysicsSystem>(mResourceSystem, rootNode);
 
         if (Settings::Manager::getBool("enable", "Navigator"))
@@ -1188,6 +1192,9 @@ namespace MWWorld
                     newPtr = currCell->moveTo(ptr, newCell);
                 else // both cells active
                 {
+                    // The object may not be added to the scene yet if the cell is streamed
+                    const bool streamed = mWorldScene->removeStreamedObject(ptr);
+
                     newPtr = currCell->moveTo(ptr, newCell);
 
                     mRendering->updatePtr(ptr, newPtr);
@@ -1205,6 +1212,9 @@ namespace MWWorld
                         mLocalScripts.add(script, newPtr);
                         addContainerScripts(newPtr, newCell);
                     }
+
+                    if (streamed && newPtr.getRefData().isEnabled())
+                        mWorldScene->addObjectToScene(newPtr);
                 }
             }
 
@@ -2900,14 +2910,16 @@ namespace MWWorld
     }
 
     void World::loadGroundcoverFiles(const Files::Collections& fileCollections,
-        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, SceneUtil::WorkQueue* workQueue,
+        Loading::Listener* listener)
     {
         if (!Settings::groundcover().mEnabled)
             return;
 
         Log(Debug::Info) << "Loading groundcover:";
 
-        mGroundcoverStore.init(mStore.get<ESM::Static>(), fileCollections, groundcoverFiles, encoder, listener);
+        mGroundcoverStore.init(
+            mStore.get<ESM::Static>(), fileCollections, groundcoverFiles, encoder, workQueue, listener);
     }
 
     MWWorld::SpellCastState World::startSpellCast(const Ptr& actor)
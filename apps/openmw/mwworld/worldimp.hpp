@@ -10,6 +10,7 @@
 
 #include "../mwbase/world.hpp"
 
+#include "cellrefreader.hpp"
 #include "contentloader.hpp"
 #include "esmstore.hpp"
 #include "globals.hpp"
@@ -86,6 +87,7 @@ namespace MWWorld
         Resource::ResourceSystem* mResourceSystem;
 
         ESM::ReadersCache mReaders;
+        CellRefReader mCellRefReader;
         MWWorld::ESMStore mStore;
         GroundcoverStore mGroundcoverStore;
         LocalScripts mLocalScripts;
@@ -177,7 +179,7 @@ namespace MWWorld
 
         void loadGroundcoverFiles(const Files::Collections& fileCollections,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
-            Loading::Listener* listener);
+            SceneUtil::WorkQueue* workQueue, Loading::Listener* listener);
 
         float feetToGameUnits(float feet);
         float getActivationDistancePlusTelekinesis();
@@ -198,7 +200,7 @@ namespace MWWorld
 
         void loadData(const Files::Collections& fileCollections, const std::vector<std::string>& contentFiles,
             const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
-            Loading::Listener* listener);
+            SceneUtil::WorkQueue* workQueue, Loading::Listener* listener);
 
         // Must be called after `loadData`.
         void init(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode, SceneUtil::WorkQueue* workQueue,
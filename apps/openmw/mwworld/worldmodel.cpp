@@ -30,23 +30,23 @@ namespace MWWorld
 
         template <class T>
         CellStore& emplaceCellStore(ESM::RefId id, const T& cell, ESMStore& store, ESM::ReadersCache& readers,
-            std::unordered_map<ESM::RefId, CellStore>& cells)
+            const CellRefReader& cellRefReader, std::unordered_map<ESM::RefId, CellStore>& cells)
         {
-            const auto [it, inserted] = cells.emplace(
-                std::piecewise_construct, std::forward_as_tuple(id), std::forward_as_tuple(Cell(cell), store, readers));
+            const auto [it, inserted] = cells.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+                std::forward_as_tuple(Cell(cell), store, readers, cellRefReader));
             assert(inserted);
             return it->second;
         }
 
         CellStore* emplaceInteriorCellStore(std::string_view name, ESMStore& store, ESM::ReadersCache& readers,
-            std::unordered_map<ESM::RefId, CellStore>& cells)
+            const CellRefReader& cellRefReader, std::unordered_map<ESM::RefId, CellStore>& cells)
         {
             if (const ESM::Cell* cell = store.get<ESM::Cell>().search(name))
-                return &emplaceCellStore(cell->mId, *cell, store, readers, cells);
+                return &emplaceCellStore(cell->mId, *cell, store, readers, cellRefReader, cells);
             if (const ESM4::Cell* cell = store.get<ESM4::Cell>().searchCellName(name);
                 cell != nullptr && !cell->isExterior())
             {
-                return &emplaceCellStore(cell->mId, *cell, store, readers, cells);
+                return &emplaceCellStore(cell->mId, *cell, store, readers, cellRefReader, cells);
             }
             return nullptr;
         }
@@ -114,7 +114,7 @@ MWWorld::CellStore& MWWorld::WorldModel::getOrInsertCellStore(const ESM::Cell& c
 
 MWWorld::CellStore& MWWorld::WorldModel::insertCellStore(const ESM::Cell& cell)
 {
-    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mCells);
+    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mCellRefReader, mCells);
     if (cell.mData.mFlags & ESM::Cell::Interior)
         mInteriors.emplace(cell.mName, &cellStore);
     else
@@ -166,9 +166,11 @@ void MWWorld::WorldModel::writeCell(ESM::ESMWriter& writer, CellStore& cell) con
     writer.endRecord(ESM::REC_CSTA);
 }
 
-MWWorld::WorldModel::WorldModel(MWWorld::ESMStore& store, ESM::ReadersCache& readers)
+MWWorld::WorldModel::WorldModel(
+    MWWorld::ESMStore& store, ESM::ReadersCache& readers, const CellRefReader& cellRefReader)
     : mStore(store)
     , mReaders(readers)
+    , mCellRefReader(cellRefReader)
     , mIdCache(Settings::cells().mPointersCacheSize, { ESM::RefId(), nullptr })
 {
     mDraftCell.mId = draftCellId;
@@ -185,7 +187,7 @@ namespace MWWorld
         {
             auto [cell, created] = createExteriorCell(location, mStore);
             const ESM::RefId id = cell.getId();
-            cellStore = &emplaceCellStore(id, std::move(cell), mStore, mReaders, mCells);
+            cellStore = &emplaceCellStore(id, std::move(cell), mStore, mReaders, mCellRefReader, mCells);
             mExteriors.emplace(location, cellStore);
             if (created)
                 MWBase::Environment::get().getLuaManager()->exteriorCreated(*cellStore);
@@ -209,7 +211,7 @@ namespace MWWorld
 
         if (it == mInteriors.end())
         {
-            cellStore = emplaceInteriorCellStore(name, mStore, mReaders, mCells);
+            cellStore = emplaceInteriorCellStore(name, mStore, mReaders, mCellRefReader, mCells);
             if (cellStore == nullptr)
                 return cellStore;
             mInteriors.emplace(name, cellStore);
@@ -247,7 +249,7 @@ namespace MWWorld
 
         if (id == draftCellId)
         {
-            CellStore& cellStore = emplaceCellStore(id, Cell(mDraftCell), mStore, mReaders, mCells);
+            CellStore& cellStore = emplaceCellStore(id, Cell(mDraftCell), mStore, mReaders, mCellRefReader, mCells);
             cellStore.load();
             return &cellStore;
         }
@@ -261,7 +263,7 @@ namespace MWWorld
         if (!cell.has_value())
             return nullptr;
 
-        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mCells);
+        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mCellRefReader, mCells);
 
         if (cellStore.isExterior())
             mExteriors.emplace(ESM::ExteriorCellLocation(cellStore.getCell()->getGridX(),
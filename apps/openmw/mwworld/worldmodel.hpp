@@ -34,13 +34,14 @@ namespace Loading
 
 namespace MWWorld
 {
+    class CellRefReader;
     class ESMStore;
 
     /// \brief Cell container
     class WorldModel
     {
     public:
-        explicit WorldModel(ESMStore& store, ESM::ReadersCache& reader);
+        explicit WorldModel(ESMStore& store, ESM::ReadersCache& reader, const CellRefReader& cellRefReader);
 
         WorldModel(const WorldModel&) = delete;
         WorldModel& operator=(const WorldModel&) = delete;
@@ -106,6 +107,7 @@ namespace MWWorld
 
         MWWorld::ESMStore& mStore;
         ESM::ReadersCache& mReaders;
+        const CellRefReader& mCellRefReader;
         mutable std::unordered_map<ESM::RefId, CellStore> mCells;
         mutable std::map<std::string, CellStore*, Misc::StringUtils::CiComp> mInteriors;
         mutable std::map<ESM::ExteriorCellLocation, CellStore*> mExteriors;
@@ -79,6 +79,27 @@ namespace OpenMW
             "load a save game file on game startup (specify an absolute filename or a filename relative to the current "
             "working directory)");
 
+        addOption("trace-file", bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), ""),
+            "record trace of the engine subsystems from startup and write it to the file on exit in Chrome trace "
+            "event format");
+
+        addOption("benchmark", bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), ""),
+            "run the game for a number of frames with a fixed timestep, write timings of every frame in milliseconds "
+            "as CSV to the file and quit (use with load-savegame or skip-menu and start to choose where it runs)");
+
+        addOption("benchmark-frames", bpo::value<unsigned>()->default_value(1000), "number of frames to benchmark");
+
+        addOption("benchmark-timestep", bpo::value<float>()->default_value(1.f / 60, "1/60"),
+            "simulation time of every benchmark frame in seconds");
+
+        addOption("benchmark-script",
+            bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), ""),
+            "file with console commands to execute during the benchmark, every line has a form of "
+            "\"<frame> <command>\"");
+
+        addOption("benchmark-no-render", bpo::value<bool>()->implicit_value(true)->default_value(false),
+            "hide the window and skip rendering during the benchmark");
+
         addOption("skip-menu", bpo::value<bool>()->implicit_value(true)->default_value(false),
             "skip main menu on game startup");
 
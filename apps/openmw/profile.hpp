@@ -1,6 +1,8 @@
 #ifndef OPENMW_PROFILE_H
 #define OPENMW_PROFILE_H
 
+#include <components/debug/tracing.hpp>
+
 #include <osg/Stats>
 #include <osg/Timer>
 
@@ -12,12 +14,14 @@ namespace OMW
     struct UserStats
     {
         const std::string mLabel;
+        const std::string mName;
         const std::string mBegin;
         const std::string mEnd;
         const std::string mTaken;
 
         explicit UserStats(const std::string& label, const std::string& prefix)
             : mLabel(label)
+            , mName(prefix)
             , mBegin(prefix + "_time_begin")
             , mEnd(prefix + "_time_end")
             , mTaken(prefix + "_time_taken")
@@ -122,6 +126,7 @@ namespace OMW
             , mFrameNumber(frameNumber)
             , mTimer(timer)
             , mStats(stats)
+            , mTrace(UserStatsValue<type>::sValue.mName.c_str())
         {
         }
 
@@ -147,6 +152,7 @@ namespace OMW
         const unsigned int mFrameNumber;
         const osg::Timer& mTimer;
         osg::Stats& mStats;
+        const Debug::ScopedTrace mTrace;
     };
 }
 
@@ -0,0 +1,69 @@
+#include <components/debug/tracing.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    using namespace testing;
+
+    std::string getTrace()
+    {
+        std::ostringstream stream;
+        Debug::writeTrace(stream);
+        return stream.str();
+    }
+
+    TEST(DebugTracingTest, shouldWriteRecordedScopes)
+    {
+        Debug::setTracing(true);
+        {
+            Debug::ScopedTrace trace("DebugTracingTest_recorded");
+        }
+        Debug::setTracing(false);
+        const std::string result = getTrace();
+        EXPECT_THAT(result, StartsWith("{\"traceEvents\":["));
+        EXPECT_THAT(result, HasSubstr("{\"name\":\"DebugTracingTest_recorded\",\"ph\":\"X\",\"pid\":1,"));
+    }
+
+    TEST(DebugTracingTest, shouldNotRecordScopesWhenDisabled)
+    {
+        Debug::setTracing(false);
+        {
+            Debug::ScopedTrace trace("DebugTracingTest_disabled");
+        }
+        EXPECT_THAT(getTrace(), Not(HasSubstr("DebugTracingTest_disabled")));
+    }
+
+    TEST(DebugTracingTest, shouldWriteThreadName)
+    {
+        Debug::setTracing(true);
+        std::thread([] {
+            Debug::setTraceThreadName("DebugTracingTest \"thread\"");
+            Debug::ScopedTrace trace("DebugTracingTest_thread");
+        }).join();
+        Debug::setTracing(false);
+        const std::string result = getTrace();
+        EXPECT_THAT(result, HasSubstr("\"args\":{\"name\":\"DebugTracingTest \\\"thread\\\"\"}"));
+        EXPECT_THAT(result, HasSubstr("DebugTracingTest_thread"));
+    }
+
+    TEST(DebugTracingTest, shouldKeepOnlyLastEventsOfThread)
+    {
+        Debug::setTracing(true);
+        std::thread([] {
+            {
+                Debug::ScopedTrace trace("DebugTracingTest_first");
+            }
+            for (int i = 0; i < 1 << 16; ++i)
+                Debug::ScopedTrace trace("DebugTracingTest_last");
+        }).join();
+        Debug::setTracing(false);
+        const std::string result = getTrace();
+        EXPECT_THAT(result, Not(HasSubstr("DebugTracingTest_first")));
+        EXPECT_THAT(result, HasSubstr("DebugTracingTest_last"));
+    }
+}
@@ -1,20 +1,28 @@
 #include "settings.hpp"
 
+#include "../testing_util.hpp"
+
 #include <components/detournavigator/asyncnavmeshupdater.hpp>
 #include <components/detournavigator/dbrefgeometryobject.hpp>
 #include <components/detournavigator/makenavmesh.hpp>
 #include <components/detournavigator/navmeshdbutils.hpp>
 #include <components/detournavigator/serialization.hpp>
+#include <components/files/conversion.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/sqlite3/db.hpp>
 
 #include <BulletCollision/CollisionShapes/btBoxShape.h>
 
 #include <DetourNavMesh.h>
 
+#include <sqlite3.h>
+
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <limits>
 #include <map>
+#include <set>
 
 namespace
 {
@@ -45,6 +53,15 @@ namespace
         recastMeshManager.addObject(id, collisionShape, btTransform::getIdentity(), AreaType_ground, nullptr);
     }
 
+    std::map<TilePosition, ChangeType> makeChangedTiles(int distance)
+    {
+        std::map<TilePosition, ChangeType> result;
+        for (int x = -distance; x <= distance; ++x)
+            for (int y = -distance; y <= distance; ++y)
+                result.emplace(TilePosition{ x, y }, ChangeType::add);
+        return result;
+    }
+
     struct DetourNavigatorAsyncNavMeshUpdaterTest : Test
     {
         Settings mSettings = makeSettings();
@@ -55,6 +72,38 @@ namespace
         const std::string mWorldspace = "sys::default";
         const btBoxShape mBox{ btVector3(100, 100, 20) };
         Loading::Listener mListener;
+
+        // Returns ids of the tiles found in the db for each tile present in the navmesh
+        std::map<TilePosition, TileId> findTiles(NavMeshDb& db, const GuardedNavMeshCacheItem& navMeshCacheItem,
+            const std::map<TilePosition, ChangeType>& changedTiles)
+        {
+            std::map<TilePosition, TileId> result;
+            for (const auto& [tilePosition, changeType] : changedTiles)
+            {
+                const auto recastMesh = mRecastMeshManager.getMesh(mWorldspace, tilePosition);
+                EXPECT_NE(recastMesh, nullptr) << tilePosition.x() << " " << tilePosition.y();
+                if (recastMesh == nullptr)
+                    continue;
+                const auto objects = makeDbRefGeometryObjects(
+                    recastMesh->getMeshSources(), [&](const MeshSource& v) { return resolveMeshSource(db, v); });
+                EXPECT_FALSE(std::holds_alternative<MeshSource>(objects))
+                    << tilePosition.x() << " " << tilePosition.y();
+                if (std::holds_alternative<MeshSource>(objects))
+                    continue;
+                const auto tile = db.findTile(mWorldspace, tilePosition,
+                    serialize(mSettings.mRecast, mAgentBounds, *recastMesh,
+                        std::get<std::vector<DbRefGeometryObject>>(objects)));
+                const bool present
+                    = navMeshCacheItem.lockConst()->getImpl().getTileRefAt(tilePosition.x(), tilePosition.y(), 0) != 0;
+                EXPECT_EQ(tile.has_value(), present) << tilePosition.x() << " " << tilePosition.y();
+                if (tile.has_value())
+                {
+                    EXPECT_EQ(tile->mVersion, navMeshFormatVersion) << tilePosition.x() << " " << tilePosition.y();
+                    result.emplace(tilePosition, tile->mTileId);
+                }
+            }
+            return result;
+        }
     };
 
     TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, for_all_jobs_done_when_empty_wait_should_terminate)
@@ -299,4 +348,129 @@ namespace
                     << " present=" << (present.find(tilePosition) != present.end());
             }
     }
+
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_write_each_generated_tile_once_with_batched_writes)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace, nullptr);
+        for (int x = -1; x <= 1; ++x)
+            for (int y = -1; y <= 1; ++y)
+                addHeightFieldPlane(mRecastMeshManager, osg::Vec2i(x, y));
+        mSettings.mMaxDbWriteBatchSize = 4;
+        mSettings.mMaxDbWriteBatchDelay = std::chrono::hours(1);
+        auto db = std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max());
+        NavMeshDb* const dbPtr = db.get();
+        AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+        const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(1, mSettings);
+        const std::map<TilePosition, ChangeType> changedTiles = makeChangedTiles(5);
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+        updater.wait(WaitConditionType::allJobsDone, &mListener);
+        {
+            const auto stats = updater.getStats();
+            ASSERT_TRUE(stats.mDb.has_value());
+            EXPECT_EQ(stats.mDb->mJobs.mWritingJobs, 0);
+            EXPECT_EQ(stats.mDb->mJobs.mReadingJobs, 0);
+            EXPECT_EQ(stats.mDb->mGetTileCount, changedTiles.size());
+            EXPECT_EQ(stats.mDbGetTileHits, 0);
+        }
+        updater.stop();
+        const std::map<TilePosition, TileId> tiles = findTiles(*dbPtr, *navMeshCacheItem, changedTiles);
+        ASSERT_FALSE(tiles.empty());
+        std::set<TileId> tileIds;
+        for (const auto& [tilePosition, tileId] : tiles)
+            EXPECT_TRUE(tileIds.insert(tileId).second) << tilePosition.x() << " " << tilePosition.y();
+        EXPECT_EQ(*tileIds.begin(), 1);
+        EXPECT_EQ(dbPtr->getMaxTileId(), static_cast<std::int64_t>(tiles.size()));
+    }
+
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_read_ahead_tiles_written_in_batches_from_db)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace, nullptr);
+        for (int x = -1; x <= 1; ++x)
+            for (int y = -1; y <= 1; ++y)
+                addHeightFieldPlane(mRecastMeshManager, osg::Vec2i(x, y));
+        const std::filesystem::path dbPath = TestingOpenMW::outputFilePath("navmesh_read_ahead.db");
+        std::filesystem::remove(dbPath);
+        const std::string dbPathString = Files::pathToUnicodeString(dbPath);
+        const std::map<TilePosition, ChangeType> changedTiles = makeChangedTiles(5);
+        mSettings.mMaxDbWriteBatchSize = 4;
+        mSettings.mMaxDbWriteBatchDelay = std::chrono::hours(1);
+        std::map<TilePosition, TileId> writtenTiles;
+        {
+            auto db = std::make_unique<NavMeshDb>(dbPathString, std::numeric_limits<std::uint64_t>::max());
+            AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+            const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(1, mSettings);
+            updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+            updater.wait(WaitConditionType::allJobsDone, &mListener);
+            updater.stop();
+            NavMeshDb resultDb(dbPathString, std::numeric_limits<std::uint64_t>::max());
+            writtenTiles = findTiles(resultDb, *navMeshCacheItem, changedTiles);
+        }
+        ASSERT_FALSE(writtenTiles.empty());
+        mSettings.mMaxNavMeshTilesCacheSize = 0;
+        mSettings.mDbReadAheadDistance = 5;
+        {
+            auto db = std::make_unique<NavMeshDb>(dbPathString, std::numeric_limits<std::uint64_t>::max());
+            AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+            const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(1, mSettings);
+            updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+            updater.wait(WaitConditionType::allJobsDone, &mListener);
+            {
+                const auto stats = updater.getStats();
+                ASSERT_TRUE(stats.mDb.has_value());
+                EXPECT_EQ(stats.mDb->mJobs.mWritingJobs, 0);
+                EXPECT_EQ(stats.mDb->mJobs.mReadingJobs, 0);
+                EXPECT_EQ(stats.mDb->mGetTileCount, changedTiles.size());
+                // The first job may be read before the read ahead request is handled
+                EXPECT_GT(stats.mDb->mReadAheadHitCount, 0);
+                EXPECT_LE(stats.mDb->mReadAheadHitCount, changedTiles.size());
+                EXPECT_EQ(stats.mDbGetTileHits, writtenTiles.size());
+            }
+            updater.stop();
+            NavMeshDb resultDb(dbPathString, std::numeric_limits<std::uint64_t>::max());
+            EXPECT_EQ(findTiles(resultDb, *navMeshCacheItem, changedTiles), writtenTiles);
+            EXPECT_EQ(resultDb.getMaxTileId(), static_cast<std::int64_t>(writtenTiles.size()));
+        }
+    }
+
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, failed_commit_of_batched_writes_should_disable_writes_to_db)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace, nullptr);
+        for (int x = -1; x <= 1; ++x)
+            for (int y = -1; y <= 1; ++y)
+                addHeightFieldPlane(mRecastMeshManager, osg::Vec2i(x, y));
+        const std::filesystem::path dbPath = TestingOpenMW::outputFilePath("navmesh_failed_commit.db");
+        std::filesystem::remove(dbPath);
+        const std::string dbPathString = Files::pathToUnicodeString(dbPath);
+        mSettings.mMaxDbWriteBatchSize = 4;
+        mSettings.mMaxDbWriteBatchDelay = std::chrono::hours(1);
+        auto db = std::make_unique<NavMeshDb>(dbPathString, std::numeric_limits<std::uint64_t>::max());
+        // An open read transaction of another connection makes commits fail with "database is locked"
+        const Sqlite3::Db reader = Sqlite3::makeDb(dbPathString, "");
+        ASSERT_EQ(
+            sqlite3_exec(reader.get(), "BEGIN; SELECT count(*) FROM tiles;", nullptr, nullptr, nullptr), SQLITE_OK);
+        AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+        const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(1, mSettings);
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, makeChangedTiles(2));
+        updater.wait(WaitConditionType::allJobsDone, &mListener);
+        ASSERT_EQ(sqlite3_exec(reader.get(), "COMMIT;", nullptr, nullptr, nullptr), SQLITE_OK);
+        // Tiles generated after the lock is released are not written either
+        std::map<TilePosition, ChangeType> changedTiles;
+        for (int x = 3; x <= 5; ++x)
+            for (int y = -5; y <= 5; ++y)
+                changedTiles.emplace(TilePosition{ x, y }, ChangeType::add);
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+        updater.wait(WaitConditionType::allJobsDone, &mListener);
+        {
+            const auto stats = updater.getStats();
+            ASSERT_TRUE(stats.mDb.has_value());
+            EXPECT_EQ(stats.mDb->mJobs.mWritingJobs, 0);
+            EXPECT_EQ(stats.mDb->mJobs.mReadingJobs, 0);
+        }
+        updater.stop();
+        for (const auto& [tilePosition, changeType] : changedTiles)
+            EXPECT_NE(navMeshCacheItem->lockConst()->getImpl().getTileRefAt(tilePosition.x(), tilePosition.y(), 0), 0u)
+                << tilePosition.x() << " " << tilePosition.y();
+        NavMeshDb resultDb(dbPathString, std::numeric_limits<std::uint64_t>::max());
+        EXPECT_EQ(resultDb.getMaxTileId(), 0);
+    }
 }
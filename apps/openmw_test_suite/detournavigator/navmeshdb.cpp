@@ -1,6 +1,7 @@
 #include "generate.hpp"
 
 #include <components/detournavigator/navmeshdb.hpp>
+#include <components/misc/compression.hpp>
 
 #include <DetourAlloc.h>
 
@@ -168,6 +169,74 @@ namespace
                     << "x=" << x << " y=" << y;
     }
 
+    TEST_F(DetourNavigatorNavMeshDbTest, get_compressed_tiles_should_return_tiles_inside_range_except_excluded)
+    {
+        TileId tileId{ 1 };
+        const TileVersion version{ 1 };
+        const std::string worldspace = "sys::default";
+        const std::vector<std::byte> input = generateData();
+        const std::vector<std::byte> data = generateData();
+        for (int x = -2; x <= 2; ++x)
+        {
+            for (int y = -2; y <= 2; ++y)
+            {
+                ASSERT_EQ(mDb.insertTile(tileId, worldspace, TilePosition{ x, y }, version, input, data), 1);
+                ++tileId;
+            }
+        }
+        const TilesPositionsRange range{ TilePosition{ -1, -1 }, TilePosition{ 2, 2 } };
+        const TilesPositionsRange excludedRange{ TilePosition{ 0, 0 }, TilePosition{ 2, 2 } };
+        const std::vector<CompressedTile> result = mDb.getCompressedTiles(worldspace, range, excludedRange);
+        ASSERT_EQ(result.size(), 5);
+        for (const CompressedTile& tile : result)
+        {
+            EXPECT_TRUE(tile.mTilePosition.x() == -1 || tile.mTilePosition.y() == -1);
+            EXPECT_EQ(tile.mVersion, version);
+            EXPECT_EQ(Misc::decompress(tile.mData), data);
+        }
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, inserted_tile_input_hash_should_be_found_for_existing_tile)
+    {
+        const TileId tileId{ 42 };
+        const auto [worldspace, tilePosition, input, data] = insertTile(tileId, TileVersion{ 1 });
+        const std::vector<std::byte> hash = generateData();
+        ASSERT_EQ(mDb.insertTileInputHash(worldspace, tilePosition, hash, tileId), 1);
+        EXPECT_THAT(mDb.findTileInputHash(worldspace, tilePosition, hash), Optional(tileId));
+        EXPECT_EQ(mDb.findTileInputHash(worldspace, tilePosition, generateData()), std::nullopt);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, tile_input_hash_should_not_be_found_for_removed_tile)
+    {
+        const TileId tileId{ 42 };
+        const auto [worldspace, tilePosition, input, data] = insertTile(tileId, TileVersion{ 1 });
+        const std::vector<std::byte> hash = generateData();
+        ASSERT_EQ(mDb.insertTileInputHash(worldspace, tilePosition, hash, tileId), 1);
+        ASSERT_EQ(mDb.deleteTilesAt(worldspace, tilePosition), 1);
+        EXPECT_EQ(mDb.findTileInputHash(worldspace, tilePosition, hash), std::nullopt);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, tile_input_hash_for_empty_tile_should_be_found_with_zero_tile_id)
+    {
+        const std::string worldspace = "sys::default";
+        const TilePosition tilePosition{ 3, 4 };
+        const std::vector<std::byte> hash = generateData();
+        ASSERT_EQ(mDb.insertTileInputHash(worldspace, tilePosition, hash, TileId{ 0 }), 1);
+        EXPECT_THAT(mDb.findTileInputHash(worldspace, tilePosition, hash), Optional(TileId{ 0 }));
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, inserted_tile_input_hash_should_replace_previous_one)
+    {
+        const std::string worldspace = "sys::default";
+        const TilePosition tilePosition{ 3, 4 };
+        const std::vector<std::byte> oldHash = generateData();
+        const std::vector<std::byte> newHash = generateData();
+        ASSERT_EQ(mDb.insertTileInputHash(worldspace, tilePosition, oldHash, TileId{ 0 }), 1);
+        ASSERT_EQ(mDb.insertTileInputHash(worldspace, tilePosition, newHash, TileId{ 0 }), 1);
+        EXPECT_EQ(mDb.findTileInputHash(worldspace, tilePosition, oldHash), std::nullopt);
+        EXPECT_THAT(mDb.findTileInputHash(worldspace, tilePosition, newHash), Optional(TileId{ 0 }));
+    }
+
     TEST_F(DetourNavigatorNavMeshDbTest, should_support_file_size_limit)
     {
         mDb = NavMeshDb(":memory:", 4096);
@@ -42,6 +42,9 @@ namespace DetourNavigator
             result.mMaxTilesNumber = 512;
             result.mMinUpdateInterval = std::chrono::milliseconds(50);
             result.mWriteToNavMeshDb = true;
+            result.mMaxDbWriteBatchSize = 1;
+            result.mMaxDbWriteBatchDelay = std::chrono::milliseconds(0);
+            result.mDbReadAheadDistance = 0;
             return result;
         }
     }
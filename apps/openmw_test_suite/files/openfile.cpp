@@ -0,0 +1,97 @@
+#include <components/files/memorystream.hpp>
+#include <components/files/openfile.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+    using namespace Files;
+
+    void writeFile(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream << content;
+    }
+
+    std::string read(std::istream& stream, std::size_t size)
+    {
+        std::string result(size, '\0');
+        stream.read(result.data(), static_cast<std::streamsize>(size));
+        result.resize(static_cast<std::size_t>(stream.gcount()));
+        return result;
+    }
+
+    TEST(FilesIMemStreamTest, seek_should_move_to_position_inside_buffer)
+    {
+        const std::string content = "0123456789";
+        IMemStream stream(content.data(), content.size());
+        EXPECT_EQ(stream.seekg(3).tellg(), 3);
+        EXPECT_EQ(read(stream, 2), "34");
+        EXPECT_EQ(stream.seekg(-3, std::ios::cur).tellg(), 2);
+        EXPECT_EQ(stream.seekg(-1, std::ios::end).tellg(), 9);
+        EXPECT_EQ(read(stream, 2), "9");
+        stream.clear();
+        EXPECT_EQ(stream.seekg(0, std::ios::end).tellg(), 10);
+    }
+
+    TEST(FilesIMemStreamTest, seek_outside_buffer_should_fail_and_keep_position)
+    {
+        const std::string content = "0123456789";
+        IMemStream stream(content.data(), content.size());
+        stream.seekg(4);
+        EXPECT_TRUE(stream.seekg(-5, std::ios::cur).fail());
+        stream.clear();
+        EXPECT_TRUE(stream.seekg(7, std::ios::cur).fail());
+        stream.clear();
+        EXPECT_TRUE(stream.seekg(1, std::ios::end).fail());
+        stream.clear();
+        EXPECT_TRUE(stream.seekg(11).fail());
+        stream.clear();
+        EXPECT_EQ(stream.tellg(), 4);
+        EXPECT_EQ(read(stream, 1), "4");
+    }
+
+    TEST(FilesOpenMappedInputFileStreamTest, should_read_and_seek_file_content)
+    {
+        const auto path = outputFilePath("openfile_mapped.bin");
+        writeFile(path, "0123456789");
+        const auto stream = openMappedInputFileStream(path);
+        EXPECT_EQ(stream->exceptions(), std::ios::badbit);
+        EXPECT_EQ(read(*stream, 4), "0123");
+        EXPECT_EQ(stream->seekg(2, std::ios::cur).tellg(), 6);
+        EXPECT_EQ(read(*stream, 2), "67");
+        EXPECT_EQ(stream->seekg(-2, std::ios::end).tellg(), 8);
+        EXPECT_EQ(read(*stream, 10), "89");
+        EXPECT_TRUE(stream->eof());
+        stream->clear();
+        EXPECT_EQ(stream->seekg(1).tellg(), 1);
+        EXPECT_EQ(read(*stream, 1), "1");
+        EXPECT_TRUE(stream->seekg(11).fail());
+    }
+
+    TEST(FilesOpenMappedInputFileStreamTest, should_open_empty_file_as_regular_stream)
+    {
+        const auto path = outputFilePath("openfile_empty.bin");
+        writeFile(path, "");
+        const auto stream = openMappedInputFileStream(path);
+        EXPECT_NE(dynamic_cast<std::ifstream*>(stream.get()), nullptr);
+        EXPECT_EQ(stream->exceptions(), std::ios::badbit);
+        EXPECT_EQ(read(*stream, 1), "");
+        EXPECT_TRUE(stream->eof());
+    }
+
+    TEST(FilesOpenMappedInputFileStreamTest, should_throw_when_file_can_not_be_opened)
+    {
+        const auto path = outputFilePath("openfile_missing.bin");
+        std::filesystem::remove(path);
+        EXPECT_THROW(openMappedInputFileStream(path), std::system_error);
+    }
+}
@@ -0,0 +1,99 @@
+#include "apps/openmw/mwdialogue/infoindex.hpp"
+
+#include <components/esm3/loaddial.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWDialogue;
+
+    struct MWDialogueInfoIndexTest : Test
+    {
+        ESM::Dialogue mDialogue;
+
+        ESM::DialInfo& addInfo()
+        {
+            ESM::DialInfo& info = mDialogue.mInfo.emplace_back();
+            info.blank();
+            return info;
+        }
+
+        InfoIndex::Speaker makeNpc() const
+        {
+            InfoIndex::Speaker speaker;
+            speaker.mId = ESM::RefId::stringRefId("npc");
+            speaker.mIsNpc = true;
+            speaker.mRace = ESM::RefId::stringRefId("race");
+            speaker.mClass = ESM::RefId::stringRefId("class");
+            speaker.mFaction = ESM::RefId::stringRefId("faction");
+            return speaker;
+        }
+
+        std::vector<std::uint32_t> getCandidates(const InfoIndex::Speaker& speaker) const
+        {
+            const InfoIndex index(mDialogue);
+            std::vector<std::uint32_t> result;
+            index.getCandidates(speaker, result);
+            return result;
+        }
+    };
+
+    TEST_F(MWDialogueInfoIndexTest, should_return_candidates_for_npc_in_dialogue_order)
+    {
+        addInfo().mFaction = ESM::RefId::stringRefId("faction");
+        addInfo().mActor = ESM::RefId::stringRefId("other");
+        addInfo();
+        addInfo().mRace = ESM::RefId::stringRefId("race");
+        addInfo().mClass = ESM::RefId::stringRefId("other");
+        addInfo().mActor = ESM::RefId::stringRefId("npc");
+        addInfo().mClass = ESM::RefId::stringRefId("class");
+        addInfo().mRace = ESM::RefId::stringRefId("other");
+
+        EXPECT_THAT(getCandidates(makeNpc()), ElementsAre(0, 2, 3, 5, 6));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, should_return_only_infos_with_actor_id_for_creature)
+    {
+        addInfo();
+        addInfo().mActor = ESM::RefId::stringRefId("creature");
+        addInfo().mRace = ESM::RefId::stringRefId("race");
+        addInfo().mActor = ESM::RefId::stringRefId("creature");
+
+        InfoIndex::Speaker speaker;
+        speaker.mId = ESM::RefId::stringRefId("creature");
+
+        EXPECT_THAT(getCandidates(speaker), ElementsAre(1, 3));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, factionless_info_should_be_a_candidate_for_any_npc)
+    {
+        ESM::DialInfo& info = addInfo();
+        info.mFactionLess = true;
+        info.mFaction = ESM::RefId::stringRefId("FFFF");
+
+        EXPECT_THAT(getCandidates(makeNpc()), ElementsAre(0));
+    }
+
+    TEST_F(MWDialogueInfoIndexTest, should_decode_select_structs)
+    {
+        ESM::DialInfo::SelectStruct& selectStruct = addInfo().mSelects.emplace_back();
+        selectStruct.mSelectRule = "02000SomeGlobal";
+        selectStruct.mValue.setType(ESM::VT_Int);
+        selectStruct.mValue.setInteger(1);
+
+        const InfoIndex index(mDialogue);
+
+        ASSERT_EQ(index.getEntries().size(), 1);
+        ASSERT_EQ(index.getEntries()[0].mSelects.size(), 1);
+        const SelectWrapper& select = index.getEntries()[0].mSelects[0];
+        EXPECT_EQ(select.getFunction(), SelectWrapper::Function_Global);
+        EXPECT_EQ(select.getType(), SelectWrapper::Type_Numeric);
+        EXPECT_FALSE(select.isNpcOnly());
+        EXPECT_EQ(select.getName(), "someglobal");
+        EXPECT_TRUE(select.selectCompare(1));
+        EXPECT_FALSE(select.selectCompare(2));
+    }
+}
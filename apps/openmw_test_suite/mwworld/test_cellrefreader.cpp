@@ -0,0 +1,196 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+#include <components/sceneutil/workqueue.hpp>
+
+#include "apps/openmw/mwworld/cellrefreader.hpp"
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace MWWorld;
+
+    using LoadedRef = std::tuple<ESM::RefNum, ESM::RefId, bool>;
+
+    constexpr int numContentFiles = 12;
+    constexpr std::uint32_t numMasterRefs = 20;
+
+    ESM::CellRef makeRef(std::uint32_t index, int localContentFile, const std::string& id)
+    {
+        ESM::CellRef ref;
+        ref.blank();
+        ref.mRefNum = ESM::RefNum{ index, localContentFile };
+        ref.mRefID = ESM::RefId::stringRefId(id);
+        return ref;
+    }
+
+    // The first content file adds references to the cell, the others are its plugins. Each plugin overrides the first
+    // reference, deletes one of the other ones and adds its own ones.
+    void writeContentFile(const std::filesystem::path& path, int contentFile)
+    {
+        ESM::Cell cell;
+        cell.blank();
+        cell.mName = "Test cell";
+        cell.mData.mFlags = ESM::Cell::Interior;
+
+        ESM::ESMWriter writer;
+        writer.setFormatVersion(ESM::DefaultFormatVersion);
+        if (contentFile != 0)
+            writer.addMaster("test_cellrefreader_0.esm", 0);
+
+        std::ofstream stream(path, std::ios::binary);
+        writer.save(stream);
+        writer.startRecord(ESM::Cell::sRecordId);
+        cell.save(writer);
+        const std::string prefix = "object_" + std::to_string(contentFile) + "_";
+        if (contentFile == 0)
+        {
+            for (std::uint32_t i = 1; i <= numMasterRefs; ++i)
+                makeRef(i, 0, prefix + std::to_string(i)).save(writer);
+        }
+        else
+        {
+            makeRef(1, 1, prefix + "override").save(writer);
+            const std::uint32_t deleted = static_cast<std::uint32_t>(contentFile % (numMasterRefs - 1)) + 2;
+            makeRef(deleted, 1, "object_0_" + std::to_string(deleted)).save(writer, false, false, true);
+            for (std::uint32_t i = 1; i <= 3; ++i)
+                makeRef(i, 0, prefix + std::to_string(i)).save(writer);
+        }
+        writer.endRecord(ESM::Cell::sRecordId);
+        writer.close();
+    }
+
+    struct MWWorldCellRefReaderTest : Test
+    {
+        ESM::ReadersCache mReaders;
+        ESM::Cell mCell;
+
+        void SetUp() override
+        {
+            for (int i = 0; i < numContentFiles; ++i)
+            {
+                const std::filesystem::path path
+                    = TestingOpenMW::outputFilePath("test_cellrefreader_" + std::to_string(i) + ".esm");
+                writeContentFile(path, i);
+
+                const ESM::ReadersCache::BusyItem reader = mReaders.get(static_cast<std::size_t>(i));
+                reader->setIndex(i);
+                reader->open(path);
+                reader->resolveParentFileIndices(mReaders);
+                ASSERT_TRUE(reader->hasMoreRecs());
+                ASSERT_EQ(reader->getRecName().toInt(), ESM::Cell::sRecordId);
+                reader->getRecHeader();
+                ESM::Cell cell;
+                bool deleted = false;
+                cell.load(*reader, deleted);
+                ASSERT_FALSE(deleted);
+                if (i == 0)
+                    mCell = cell;
+                else
+                    mCell.mContextList.push_back(cell.mContextList.back());
+            }
+        }
+
+        std::vector<LoadedRef> read(const CellRefReader& cellRefReader, std::vector<std::string>& errors) const
+        {
+            std::vector<LoadedRef> result;
+            cellRefReader.read(
+                mCell,
+                [&](ESM::CellRef& ref, bool deleted) { result.emplace_back(ref.mRefNum, ref.mRefID, deleted); },
+                [&](std::string_view error) { errors.emplace_back(error); });
+            return result;
+        }
+    };
+
+    TEST_F(MWWorldCellRefReaderTest, should_read_references_of_all_content_files_in_load_order)
+    {
+        ASSERT_EQ(mCell.mContextList.size(), static_cast<std::size_t>(numContentFiles));
+        CellRefReader cellRefReader(mReaders);
+        std::vector<std::string> errors;
+        const std::vector<LoadedRef> refs = read(cellRefReader, errors);
+        EXPECT_THAT(errors, IsEmpty());
+        ASSERT_EQ(refs.size(), numMasterRefs + (numContentFiles - 1) * 5u);
+        EXPECT_EQ(refs.front(), LoadedRef(ESM::RefNum{ 1, 0 }, ESM::RefId::stringRefId("object_0_1"), false));
+        EXPECT_EQ(refs[numMasterRefs],
+            LoadedRef(ESM::RefNum{ 1, 0 }, ESM::RefId::stringRefId("object_1_override"), false));
+        EXPECT_EQ(refs.back(),
+            LoadedRef(ESM::RefNum{ 3, numContentFiles - 1 }, ESM::RefId::stringRefId("object_11_3"), false));
+    }
+
+    TEST_F(MWWorldCellRefReaderTest, parallel_read_should_give_the_same_references_in_the_same_order_as_serial)
+    {
+        CellRefReader serialReader(mReaders);
+        std::vector<std::string> serialErrors;
+        const std::vector<LoadedRef> serialRefs = read(serialReader, serialErrors);
+
+        osg::ref_ptr<SceneUtil::WorkQueue> workQueue = new SceneUtil::WorkQueue(3);
+        CellRefReader parallelReader(mReaders);
+        parallelReader.setWorkQueue(workQueue.get(), 4);
+        // Read twice to use readers kept open by the work queue threads
+        for (int i = 0; i < 2; ++i)
+        {
+            std::vector<std::string> parallelErrors;
+            EXPECT_EQ(read(parallelReader, parallelErrors), serialRefs) << i;
+            EXPECT_EQ(parallelErrors, serialErrors) << i;
+        }
+    }
+
+    TEST_F(MWWorldCellRefReaderTest, parallel_read_should_resolve_overrides_and_deletions_like_serial)
+    {
+        const auto resolve = [](const std::vector<LoadedRef>& refs) {
+            std::map<ESM::RefNum, std::pair<ESM::RefId, bool>> result;
+            for (const auto& [refNum, refId, deleted] : refs)
+                result[refNum] = { refId, deleted };
+            return result;
+        };
+
+        CellRefReader serialReader(mReaders);
+        std::vector<std::string> errors;
+        const auto serial = resolve(read(serialReader, errors));
+
+        osg::ref_ptr<SceneUtil::WorkQueue> workQueue = new SceneUtil::WorkQueue(3);
+        CellRefReader parallelReader(mReaders);
+        parallelReader.setWorkQueue(workQueue.get(), 4);
+        const auto parallel = resolve(read(parallelReader, errors));
+
+        EXPECT_EQ(parallel, serial);
+        const std::string lastOverride = "object_" + std::to_string(numContentFiles - 1) + "_override";
+        EXPECT_EQ(parallel.at(ESM::RefNum{ 1, 0 }), std::pair(ESM::RefId::stringRefId(lastOverride), false));
+        EXPECT_TRUE(parallel.at(ESM::RefNum{ 3, 0 }).second);
+        EXPECT_FALSE(parallel.at(ESM::RefNum{ numMasterRefs, 0 }).second);
+        EXPECT_THAT(errors, IsEmpty());
+    }
+
+    TEST_F(MWWorldCellRefReaderTest, parallel_read_should_report_errors_for_each_content_file_like_serial)
+    {
+        mCell.mContextList[3].filename = TestingOpenMW::outputFilePath("test_cellrefreader_missing.esm");
+        mCell.mContextList[7].filename = TestingOpenMW::outputFilePath("test_cellrefreader_missing.esm");
+
+        CellRefReader serialReader(mReaders);
+        std::vector<std::string> serialErrors;
+        const std::vector<LoadedRef> serialRefs = read(serialReader, serialErrors);
+        EXPECT_EQ(serialErrors.size(), 2u);
+
+        osg::ref_ptr<SceneUtil::WorkQueue> workQueue = new SceneUtil::WorkQueue(3);
+        CellRefReader parallelReader(mReaders);
+        parallelReader.setWorkQueue(workQueue.get(), 4);
+        std::vector<std::string> parallelErrors;
+        EXPECT_EQ(read(parallelReader, parallelErrors), serialRefs);
+        EXPECT_EQ(parallelErrors.size(), 2u);
+    }
+}
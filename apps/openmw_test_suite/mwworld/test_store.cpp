@@ -877,4 +877,31 @@ namespace
         ASSERT_NE(dialogue, nullptr);
         EXPECT_THAT(dialogue->mInfo, ElementsAre(HasIdEqualTo("info0"), HasIdEqualTo("info2")));
     }
+
+    ESM::SoundGenerator makeSoundGenerator(std::string_view id, std::string_view creature, std::string_view sound)
+    {
+        ESM::SoundGenerator result;
+        result.blank();
+        result.mId = ESM::RefId::stringRefId(id);
+        result.mCreature = ESM::RefId::stringRefId(creature);
+        result.mSound = ESM::RefId::stringRefId(sound);
+        return result;
+    }
+
+    TEST(MWWorldStoreTest, getByCreatureShouldReturnSoundGeneratorsOfCreatureInLoadOrder)
+    {
+        MWWorld::ESMStore esmStore;
+        esmStore.insertStatic(makeSoundGenerator("rat0", "rat", "rat moan"));
+        esmStore.insertStatic(makeSoundGenerator("guar0", "guar", "guar moan"));
+        esmStore.insertStatic(makeSoundGenerator("rat1", "rat", "rat roar"));
+        esmStore.setUp();
+
+        const MWWorld::Store<ESM::SoundGenerator>& store = esmStore.get<ESM::SoundGenerator>();
+        const auto rat = store.getByCreature(ESM::RefId::stringRefId("rat"));
+        ASSERT_EQ(rat.size(), 2);
+        EXPECT_EQ(rat[0]->mId, ESM::RefId::stringRefId("rat0"));
+        EXPECT_EQ(rat[1]->mId, ESM::RefId::stringRefId("rat1"));
+        EXPECT_EQ(store.getByCreature(ESM::RefId::stringRefId("guar")).size(), 1);
+        EXPECT_TRUE(store.getByCreature(ESM::RefId::stringRefId("mudcrab")).empty());
+    }
 }
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+
+#include "apps/openmw/mwworld/streamedobjects.hpp"
+
+namespace MWWorld
+{
+    namespace
+    {
+        struct Cell
+        {
+        };
+
+        // Like Ptr, compares references only and refers to the cell the object is in
+        struct Object
+        {
+            int mRef;
+            Cell* mCell;
+
+            Cell* getCell() const { return mCell; }
+
+            bool operator==(const Object& other) const { return mRef == other.mRef; }
+        };
+
+        struct MWWorldRemoveStreamedObjectTest : ::testing::Test
+        {
+            Cell mCell1;
+            Cell mCell2;
+            Cell mCell3;
+            std::deque<Object> mObjects{ { 1, &mCell1 }, { 2, &mCell1 }, { 3, &mCell2 } };
+        };
+
+        TEST_F(MWWorldRemoveStreamedObjectTest, should_not_remove_object_which_is_not_queued)
+        {
+            const RemovedStreamedObject<Object> removed = removeStreamedObject(mObjects, Object{ 4, &mCell1 });
+            EXPECT_FALSE(removed.mObject.has_value());
+            EXPECT_FALSE(removed.mLastOfCell);
+            EXPECT_EQ(mObjects.size(), 3);
+        }
+
+        TEST_F(MWWorldRemoveStreamedObjectTest, should_remove_queued_object_with_other_objects_of_cell)
+        {
+            const RemovedStreamedObject<Object> removed = removeStreamedObject(mObjects, Object{ 2, &mCell1 });
+            ASSERT_TRUE(removed.mObject.has_value());
+            EXPECT_EQ(removed.mObject->mRef, 2);
+            EXPECT_FALSE(removed.mLastOfCell);
+            EXPECT_EQ(mObjects, (std::deque<Object>{ { 1, &mCell1 }, { 3, &mCell2 } }));
+        }
+
+        TEST_F(MWWorldRemoveStreamedObjectTest, should_remove_last_queued_object_of_cell)
+        {
+            const RemovedStreamedObject<Object> removed = removeStreamedObject(mObjects, Object{ 3, &mCell2 });
+            ASSERT_TRUE(removed.mObject.has_value());
+            EXPECT_TRUE(removed.mLastOfCell);
+            EXPECT_EQ(mObjects, (std::deque<Object>{ { 1, &mCell1 }, { 2, &mCell1 } }));
+        }
+
+        TEST_F(MWWorldRemoveStreamedObjectTest, should_find_object_moved_to_another_cell_by_reference)
+        {
+            const RemovedStreamedObject<Object> removed = removeStreamedObject(mObjects, Object{ 1, &mCell3 });
+            ASSERT_TRUE(removed.mObject.has_value());
+            EXPECT_EQ(removed.mObject->getCell(), &mCell1);
+            EXPECT_FALSE(removed.mLastOfCell);
+            EXPECT_EQ(mObjects, (std::deque<Object>{ { 2, &mCell1 }, { 3, &mCell2 } }));
+        }
+
+        TEST_F(MWWorldRemoveStreamedObjectTest, removing_all_objects_of_cell_should_report_the_last_one)
+        {
+            EXPECT_FALSE(removeStreamedObject(mObjects, Object{ 1, &mCell1 }).mLastOfCell);
+            EXPECT_TRUE(removeStreamedObject(mObjects, Object{ 2, &mCell1 }).mLastOfCell);
+            EXPECT_EQ(mObjects, (std::deque<Object>{ { 3, &mCell2 } }));
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#include <components/sceneutil/lightcluster.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    std::vector<std::uint32_t> collectUnique(const LightClusterGrid& grid, const osg::BoundingSphere& bound)
+    {
+        std::vector<std::uint32_t> result;
+        EXPECT_TRUE(grid.collect(bound, result));
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    TEST(SceneUtilLightClusterGridTest, collect_should_return_false_for_empty_grid)
+    {
+        LightClusterGrid grid;
+        std::vector<std::uint32_t> indices;
+        EXPECT_FALSE(grid.collect(osg::BoundingSphere(osg::Vec3f(0, 0, -100), 10), indices));
+        EXPECT_THAT(indices, IsEmpty());
+    }
+
+    TEST(SceneUtilLightClusterGridTest, collect_should_return_only_lights_in_covered_cells)
+    {
+        LightClusterGrid grid;
+        grid.build({
+            osg::BoundingSphere(osg::Vec3f(-1000, 0, -2000), 50),
+            osg::BoundingSphere(osg::Vec3f(1000, 0, -2000), 50),
+            osg::BoundingSphere(osg::Vec3f(0, 0, -100), 20),
+        });
+        EXPECT_THAT(collectUnique(grid, osg::BoundingSphere(osg::Vec3f(1000, 0, -2000), 10)), ElementsAre(1));
+        EXPECT_THAT(collectUnique(grid, osg::BoundingSphere(osg::Vec3f(0, 0, -100), 5)), ElementsAre(2));
+    }
+
+    TEST(SceneUtilLightClusterGridTest, collect_should_return_false_for_bound_covering_too_many_cells)
+    {
+        LightClusterGrid grid;
+        grid.build({
+            osg::BoundingSphere(osg::Vec3f(-1000, 0, -2000), 50),
+            osg::BoundingSphere(osg::Vec3f(1000, 0, -2000), 50),
+        });
+        std::vector<std::uint32_t> indices;
+        EXPECT_FALSE(grid.collect(osg::BoundingSphere(osg::Vec3f(0, 0, 0), 10000), indices));
+        EXPECT_THAT(indices, IsEmpty());
+    }
+
+    TEST(SceneUtilLightClusterGridTest, collect_should_include_all_intersecting_lights)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> position(-3000, 3000);
+        std::uniform_real_distribution<float> lightRadius(0, 500);
+        std::uniform_real_distribution<float> objectRadius(0, 100);
+
+        std::vector<osg::BoundingSphere> lights;
+        for (int i = 0; i < 100; ++i)
+            lights.emplace_back(osg::Vec3f(position(random), position(random), position(random)), lightRadius(random));
+
+        LightClusterGrid grid;
+        grid.build(lights);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const osg::BoundingSphere object(
+                osg::Vec3f(position(random), position(random), position(random)), objectRadius(random));
+            std::vector<std::uint32_t> indices;
+            if (!grid.collect(object, indices))
+                continue;
+            for (std::size_t j = 0; j < lights.size(); ++j)
+                if (lights[j].intersects(object))
+                    EXPECT_THAT(indices, Contains(j)) << "object " << i << " light " << j;
+        }
+    }
+}
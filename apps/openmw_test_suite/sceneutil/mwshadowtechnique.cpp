@@ -0,0 +1,87 @@
+#include <components/sceneutil/mwshadowtechnique.hpp>
+
+#include <osg/Geometry>
+#include <osgUtil/RenderLeaf>
+#include <osgUtil/RenderStage>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    struct SceneUtilComputeReceiverBoundsTest : Test
+    {
+        // Unit cube at the world origin
+        osg::ref_ptr<osg::Geometry> mGeometry = new osg::Geometry;
+        const osg::Matrixd mViewMatrix = osg::Matrixd::lookAt({ 0, -100, 50 }, { 0, 0, 0 }, { 0, 0, 1 });
+        const osg::Matrixd mNestedViewMatrix = osg::Matrixd::translate(30, -20, 10);
+        osg::ref_ptr<osgUtil::RenderStage> mRenderStage = new osgUtil::RenderStage;
+        // Render bins don't own their leaves
+        std::vector<osg::ref_ptr<osgUtil::RenderLeaf>> mLeaves;
+
+        SceneUtilComputeReceiverBoundsTest()
+        {
+            osg::ref_ptr<osg::Vec3Array> vertices = new osg::Vec3Array;
+            vertices->push_back(osg::Vec3f(-1, -1, -1));
+            vertices->push_back(osg::Vec3f(1, 1, 1));
+            mGeometry->setVertexArray(vertices);
+        }
+
+        void addLeaf(osgUtil::RenderStage& renderStage, const osg::Matrixd& modelView)
+        {
+            const osg::ref_ptr<osgUtil::RenderLeaf> leaf
+                = new osgUtil::RenderLeaf(mGeometry, new osg::RefMatrix, new osg::RefMatrix(modelView));
+            renderStage.getRenderLeafList().push_back(leaf);
+            mLeaves.push_back(leaf);
+        }
+
+        osgUtil::RenderStage& addNestedStage(osg::Transform::ReferenceFrame referenceFrame)
+        {
+            osg::ref_ptr<osg::Camera> camera = new osg::Camera;
+            camera->setReferenceFrame(referenceFrame);
+            camera->setViewMatrix(mNestedViewMatrix);
+            osg::ref_ptr<osgUtil::RenderStage> stage = new osgUtil::RenderStage;
+            stage->setCamera(camera);
+            mRenderStage->addPreRenderStage(stage);
+            return *stage;
+        }
+    };
+
+    void expectUnitCube(const osg::BoundingBoxd& bounds)
+    {
+        ASSERT_TRUE(bounds.valid());
+        EXPECT_NEAR(bounds.xMin(), -1, 1e-6);
+        EXPECT_NEAR(bounds.yMin(), -1, 1e-6);
+        EXPECT_NEAR(bounds.zMin(), -1, 1e-6);
+        EXPECT_NEAR(bounds.xMax(), 1, 1e-6);
+        EXPECT_NEAR(bounds.yMax(), 1, 1e-6);
+        EXPECT_NEAR(bounds.zMax(), 1, 1e-6);
+    }
+
+    TEST_F(SceneUtilComputeReceiverBoundsTest, should_transform_leaves_of_render_stage_to_light_view)
+    {
+        addLeaf(*mRenderStage, mViewMatrix);
+        expectUnitCube(computeReceiverBounds(*mRenderStage, mViewMatrix, osg::Matrixd::identity()));
+        const osg::Matrixd lightViewMatrix = osg::Matrixd::translate(5, 6, 7);
+        const osg::BoundingBoxd bounds = computeReceiverBounds(*mRenderStage, mViewMatrix, lightViewMatrix);
+        EXPECT_NEAR(bounds.xMin(), 4, 1e-6);
+        EXPECT_NEAR(bounds.zMax(), 8, 1e-6);
+    }
+
+    TEST_F(SceneUtilComputeReceiverBoundsTest, should_use_view_matrix_of_absolute_nested_stage)
+    {
+        addLeaf(addNestedStage(osg::Transform::ABSOLUTE_RF), mNestedViewMatrix);
+        expectUnitCube(computeReceiverBounds(*mRenderStage, mViewMatrix, osg::Matrixd::identity()));
+    }
+
+    TEST_F(SceneUtilComputeReceiverBoundsTest, should_combine_view_matrix_of_relative_nested_stage_with_parent_view)
+    {
+        // Leaves of a relative camera are culled with its view matrix applied after the parent view
+        addLeaf(addNestedStage(osg::Transform::RELATIVE_RF), mNestedViewMatrix * mViewMatrix);
+        expectUnitCube(computeReceiverBounds(*mRenderStage, mViewMatrix, osg::Matrixd::identity()));
+    }
+}
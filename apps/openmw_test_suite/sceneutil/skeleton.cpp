@@ -0,0 +1,118 @@
+#include <components/sceneutil/skeleton.hpp>
+
+#include <osg/MatrixTransform>
+#include <osgUtil/UpdateVisitor>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    struct CountUpdatesCallback : osg::NodeCallback
+    {
+        unsigned int mCount = 0;
+
+        void operator()(osg::Node* node, osg::NodeVisitor* nv) override
+        {
+            ++mCount;
+            traverse(node, nv);
+        }
+    };
+
+    TEST(SceneUtilSkeletonTest, isUpdateSkipped_should_return_false_before_first_update)
+    {
+        Skeleton skeleton;
+        skeleton.setUpdateInterval(5);
+        EXPECT_FALSE(skeleton.isUpdateSkipped(42, 0));
+    }
+
+    TEST(SceneUtilSkeletonTest, isUpdateSkipped_should_return_false_for_each_frame_with_interval_1)
+    {
+        Skeleton skeleton;
+        for (unsigned int frame = 2; frame < 10; ++frame)
+            EXPECT_FALSE(skeleton.isUpdateSkipped(frame, frame - 1)) << frame;
+    }
+
+    TEST(SceneUtilSkeletonTest, isUpdateSkipped_should_return_true_for_even_number_of_frames_since_last_update)
+    {
+        Skeleton skeleton;
+        skeleton.setUpdateInterval(5);
+        EXPECT_TRUE(skeleton.isUpdateSkipped(10, 6));
+        skeleton.setUpdateInterval(1);
+        EXPECT_TRUE(skeleton.isUpdateSkipped(8, 6));
+        EXPECT_FALSE(skeleton.isUpdateSkipped(9, 6));
+    }
+
+    TEST(SceneUtilSkeletonTest, isUpdateSkipped_should_return_true_until_interval_passes)
+    {
+        Skeleton skeleton;
+        skeleton.setUpdateInterval(5);
+        EXPECT_TRUE(skeleton.isUpdateSkipped(7, 6));
+        EXPECT_TRUE(skeleton.isUpdateSkipped(9, 6));
+    }
+
+    TEST(SceneUtilSkeletonTest, updates_should_keep_interval_and_alternate_buffers_when_interval_changes)
+    {
+        Skeleton skeleton;
+        const std::array<unsigned int, 6> intervals{ 1, 3, 5, 3, 1, 5 };
+        const unsigned int maxInterval = 5;
+        unsigned int lastFrameNumber = 0;
+        unsigned int updates = 0;
+        for (unsigned int frame = 1; frame < 1000; ++frame)
+        {
+            const unsigned int interval = intervals[(frame / 7) % intervals.size()];
+            skeleton.setUpdateInterval(interval);
+            if (skeleton.isUpdateSkipped(frame, lastFrameNumber))
+            {
+                EXPECT_LE(frame - lastFrameNumber, 2 * maxInterval) << frame;
+                continue;
+            }
+            if (lastFrameNumber != 0)
+            {
+                EXPECT_EQ((frame - lastFrameNumber) % 2, 1u) << frame;
+                EXPECT_GE(frame - lastFrameNumber, interval) << frame;
+            }
+            lastFrameNumber = frame;
+            ++updates;
+        }
+        EXPECT_GT(updates, 0u);
+    }
+
+    TEST(SceneUtilSkeletonTest, skipped_update_should_skip_only_bone_callbacks)
+    {
+        osg::ref_ptr<Skeleton> skeleton = new Skeleton;
+        osg::ref_ptr<osg::MatrixTransform> bone = new osg::MatrixTransform;
+        bone->setName("Bone");
+        osg::ref_ptr<CountUpdatesCallback> boneCallback = new CountUpdatesCallback;
+        bone->setUpdateCallback(boneCallback);
+        osg::ref_ptr<osg::Group> attachedToBone = new osg::Group;
+        osg::ref_ptr<CountUpdatesCallback> attachedToBoneCallback = new CountUpdatesCallback;
+        attachedToBone->setUpdateCallback(attachedToBoneCallback);
+        bone->addChild(attachedToBone);
+        skeleton->addChild(bone);
+        osg::ref_ptr<osg::Group> notBone = new osg::Group;
+        osg::ref_ptr<CountUpdatesCallback> notBoneCallback = new CountUpdatesCallback;
+        notBone->setUpdateCallback(notBoneCallback);
+        skeleton->addChild(notBone);
+
+        ASSERT_NE(skeleton->getBone("bone"), nullptr);
+        skeleton->setUpdateInterval(5);
+        skeleton->updateBoneMatrices(1);
+
+        osgUtil::UpdateVisitor visitor;
+        for (unsigned int frame = 2; frame < 5; ++frame)
+        {
+            visitor.setTraversalNumber(frame);
+            ASSERT_TRUE(skeleton->isUpdateSkipped(frame, 1)) << frame;
+            skeleton->accept(visitor);
+        }
+
+        EXPECT_EQ(boneCallback->mCount, 0u);
+        EXPECT_EQ(attachedToBoneCallback->mCount, 3u);
+        EXPECT_EQ(notBoneCallback->mCount, 3u);
+    }
+}
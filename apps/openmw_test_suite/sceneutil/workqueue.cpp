@@ -0,0 +1,73 @@
+#include <components/sceneutil/workqueue.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    struct NestedParallelForItem final : WorkItem
+    {
+        WorkQueue& mWorkQueue;
+        std::vector<std::atomic_int> mCalls;
+
+        explicit NestedParallelForItem(WorkQueue& workQueue, std::size_t count)
+            : mWorkQueue(workQueue)
+            , mCalls(count)
+        {
+        }
+
+        void doWork() override
+        {
+            parallelFor(&mWorkQueue, mCalls.size(), [&](std::size_t i) { ++mCalls[i]; });
+        }
+    };
+
+    TEST(SceneUtilParallelForTest, should_call_function_once_for_each_index)
+    {
+        osg::ref_ptr<WorkQueue> workQueue = new WorkQueue(3);
+        std::vector<std::atomic_int> calls(100);
+        parallelFor(workQueue.get(), calls.size(), [&](std::size_t i) { ++calls[i]; });
+        for (std::size_t i = 0; i < calls.size(); ++i)
+            EXPECT_EQ(calls[i], 1) << i;
+    }
+
+    TEST(SceneUtilParallelForTest, should_run_on_calling_thread_without_work_queue)
+    {
+        const std::thread::id caller = std::this_thread::get_id();
+        std::vector<std::thread::id> threads(10);
+        parallelFor(nullptr, threads.size(), [&](std::size_t i) { threads[i] = std::this_thread::get_id(); });
+        EXPECT_THAT(threads, Each(caller));
+    }
+
+    TEST(SceneUtilParallelForTest, should_not_wait_for_work_queue_when_called_from_its_only_thread)
+    {
+        osg::ref_ptr<WorkQueue> workQueue = new WorkQueue(1);
+        osg::ref_ptr<NestedParallelForItem> item = new NestedParallelForItem(*workQueue, 10);
+        workQueue->addWorkItem(item);
+        item->waitTillDone();
+        for (std::size_t i = 0; i < item->mCalls.size(); ++i)
+            EXPECT_EQ(item->mCalls[i], 1) << i;
+    }
+
+    TEST(SceneUtilParallelForTest, should_rethrow_exception_after_all_calls_are_finished)
+    {
+        osg::ref_ptr<WorkQueue> workQueue = new WorkQueue(2);
+        std::atomic_int calls{ 0 };
+        EXPECT_THROW(parallelFor(workQueue.get(), 10,
+                         [&](std::size_t i) {
+                             ++calls;
+                             if (i == 5)
+                                 throw std::runtime_error("error");
+                         }),
+            std::runtime_error);
+        EXPECT_EQ(calls, 10);
+    }
+}
@@ -2,6 +2,8 @@
 #include <components/shader/shadermanager.hpp>
 
 #include <fstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -232,4 +234,85 @@ namespace
             EXPECT_FALSE(mManager.getShader(Files::pathToUnicodeString(templateName), mDefines));
         });
     }
+
+    TEST_F(ShaderManagerTest, preload_shader_variants_should_create_shaders_saved_by_other_manager)
+    {
+        const std::string content
+            = "#version 120\n"
+              "#define FLAG @flag\n"
+              "void main() {}\n";
+
+        std::string templateName;
+        mDefines["flag"] = "1";
+
+        withShaderFile(content, [&](const std::filesystem::path& path) {
+            templateName = Files::pathToUnicodeString(path);
+            ASSERT_TRUE(mManager.getShader(templateName, mDefines));
+        });
+
+        const std::filesystem::path variants = TestingOpenMW::outputFilePath("shadervariants.txt");
+        mManager.saveShaderVariants(variants);
+
+        ShaderManager manager;
+        manager.setShaderPath("tests_output");
+        EXPECT_NE(manager.preloadShaderVariants(variants), nullptr);
+
+        // The template is not read again when the shader is already created
+        std::filesystem::remove(TestingOpenMW::outputFilePathWithSubDir(templateName));
+        const auto shader = manager.getShader(templateName, mDefines);
+        ASSERT_TRUE(shader);
+        EXPECT_EQ(shader->getShaderSource(),
+            "#version 120\n"
+            "#define FLAG 1\n"
+            "void main() {}\n");
+    }
+
+    TEST_F(ShaderManagerTest, save_shader_variants_should_drop_preloaded_variants_not_requested_again)
+    {
+        const std::string content
+            = "#version 120\n"
+              "#define FLAG @flag\n"
+              "void main() {}\n";
+
+        std::string templateName;
+        ShaderManager::DefineMap otherDefines;
+        mDefines["flag"] = "1";
+        otherDefines["flag"] = "2";
+
+        withShaderFile(content, [&](const std::filesystem::path& path) {
+            templateName = Files::pathToUnicodeString(path);
+            ASSERT_TRUE(mManager.getShader(templateName, mDefines));
+            ASSERT_TRUE(mManager.getShader(templateName, otherDefines));
+        });
+
+        const std::filesystem::path variants = TestingOpenMW::outputFilePath("shadervariants_prune_1.txt");
+        mManager.saveShaderVariants(variants);
+
+        const auto readLines = [](const std::filesystem::path& path) {
+            std::ifstream file(path);
+            std::vector<std::string> lines;
+            for (std::string line; std::getline(file, line);)
+                lines.push_back(line);
+            return lines;
+        };
+        ASSERT_EQ(readLines(variants).size(), 2u);
+
+        ShaderManager manager;
+        manager.setShaderPath("tests_output");
+        EXPECT_NE(manager.preloadShaderVariants(variants), nullptr);
+        ASSERT_TRUE(manager.getShader(templateName, mDefines));
+
+        const std::filesystem::path requestedVariants = TestingOpenMW::outputFilePath("shadervariants_prune_2.txt");
+        manager.saveShaderVariants(requestedVariants);
+        const std::vector<std::string> lines = readLines(requestedVariants);
+        ASSERT_EQ(lines.size(), 1u);
+        EXPECT_NE(lines[0].find("flag=1"), std::string::npos) << lines[0];
+
+        ShaderManager unusedManager;
+        unusedManager.setShaderPath("tests_output");
+        EXPECT_NE(unusedManager.preloadShaderVariants(requestedVariants), nullptr);
+        const std::filesystem::path unusedVariants = TestingOpenMW::outputFilePath("shadervariants_prune_3.txt");
+        unusedManager.saveShaderVariants(unusedVariants);
+        EXPECT_EQ(unusedManager.preloadShaderVariants(unusedVariants), nullptr);
+    }
 }
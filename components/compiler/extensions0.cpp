@@ -327,6 +327,9 @@ namespace Compiler
             extensions.registerInstruction("reloadlua", "", opcodeReloadLua);
             extensions.registerInstruction("testmodels", "", opcodeTestModels);
             extensions.registerInstruction("t3d", "", opcodeTestModels);
+            extensions.registerInstruction("toggletracing", "", opcodeToggleTracing);
+            extensions.registerInstruction("ttr", "", opcodeToggleTracing);
+            extensions.registerInstruction("writetrace", "", opcodeWriteTrace);
         }
     }
 
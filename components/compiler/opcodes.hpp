@@ -321,6 +321,8 @@ namespace Compiler
         const int opcodeHelp = 0x2000320;
         const int opcodeReloadLua = 0x2000321;
         const int opcodeTestModels = 0x2000325;
+        const int opcodeToggleTracing = 0x2000326;
+        const int opcodeWriteTrace = 0x2000327;
     }
 
     namespace Sky
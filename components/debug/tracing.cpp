@@ -0,0 +1,245 @@
+#include "tracing.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <components/debug/debuglog.hpp>
+
+namespace Debug
+{
+    namespace Detail
+    {
+        std::atomic_bool sTracing{ false };
+    }
+
+    namespace
+    {
+        constexpr std::size_t bufferSize = 1 << 15;
+
+        struct TraceEvent
+        {
+            const char* mName;
+            std::int64_t mBegin;
+            std::int64_t mEnd;
+        };
+
+        struct TraceBuffer
+        {
+            std::uint32_t mThreadId = 0;
+            std::string mThreadName;
+            std::unique_ptr<TraceEvent[]> mEvents = std::make_unique<TraceEvent[]>(bufferSize);
+            // Only the owning thread writes events and increments the counter. Readers use it to find events which
+            // could be overwritten while they were copied.
+            std::atomic_uint64_t mWritten{ 0 };
+            std::atomic_bool mFinished{ false };
+        };
+
+        struct Registry
+        {
+            std::mutex mMutex;
+            std::vector<std::shared_ptr<TraceBuffer>> mBuffers;
+            std::uint32_t mNextThreadId = 1;
+            std::filesystem::path mFile;
+        };
+
+        Registry& getRegistry()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        struct ThreadState
+        {
+            std::shared_ptr<TraceBuffer> mBuffer;
+            std::string mName;
+
+            ~ThreadState()
+            {
+                if (mBuffer != nullptr)
+                    mBuffer->mFinished = true;
+            }
+        };
+
+        thread_local ThreadState sThreadState;
+
+        const std::chrono::steady_clock::time_point sEpoch = std::chrono::steady_clock::now();
+
+        TraceBuffer& getThreadBuffer()
+        {
+            if (sThreadState.mBuffer == nullptr)
+            {
+                auto buffer = std::make_shared<TraceBuffer>();
+                buffer->mThreadName = sThreadState.mName;
+                Registry& registry = getRegistry();
+                const std::lock_guard lock(registry.mMutex);
+                buffer->mThreadId = registry.mNextThreadId++;
+                registry.mBuffers.push_back(buffer);
+                sThreadState.mBuffer = std::move(buffer);
+            }
+            return *sThreadState.mBuffer;
+        }
+
+        void writeString(std::ostream& stream, std::string_view value)
+        {
+            stream << '"';
+            for (const char c : value)
+            {
+                if (c == '"' || c == '\\')
+                    stream << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    stream << ' ';
+                else
+                    stream << c;
+            }
+            stream << '"';
+        }
+
+        double toMicroseconds(std::int64_t value)
+        {
+            return static_cast<double>(value) / 1000.0;
+        }
+    }
+
+    std::int64_t Detail::getTraceTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sEpoch)
+            .count();
+    }
+
+    void Detail::recordTrace(const char* name, std::int64_t begin, std::int64_t end)
+    {
+        TraceBuffer& buffer = getThreadBuffer();
+        const std::uint64_t index = buffer.mWritten.load(std::memory_order_relaxed);
+        buffer.mEvents[index % bufferSize] = TraceEvent{ name, begin, end };
+        buffer.mWritten.store(index + 1, std::memory_order_release);
+    }
+
+    void setTracing(bool enabled)
+    {
+        if (enabled)
+        {
+            // Buffers of the exited threads are kept to be written until the next recording starts
+            Registry& registry = getRegistry();
+            const std::lock_guard lock(registry.mMutex);
+            std::erase_if(registry.mBuffers, [](const auto& buffer) { return buffer->mFinished.load(); });
+        }
+
+        Detail::sTracing = enabled;
+    }
+
+    void setTraceThreadName(std::string_view name)
+    {
+        sThreadState.mName = name;
+        if (sThreadState.mBuffer == nullptr)
+            return;
+        const std::lock_guard lock(getRegistry().mMutex);
+        sThreadState.mBuffer->mThreadName = name;
+    }
+
+    void writeTrace(std::ostream& stream)
+    {
+        struct ThreadEvents
+        {
+            std::uint32_t mThreadId;
+            std::string mThreadName;
+            std::vector<TraceEvent> mEvents;
+        };
+
+        std::vector<std::shared_ptr<TraceBuffer>> buffers;
+        std::vector<ThreadEvents> threads;
+        {
+            Registry& registry = getRegistry();
+            const std::lock_guard lock(registry.mMutex);
+            buffers = registry.mBuffers;
+            for (const auto& buffer : buffers)
+                threads.push_back(ThreadEvents{ buffer->mThreadId, buffer->mThreadName, {} });
+        }
+
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            const TraceBuffer& buffer = *buffers[i];
+            const std::uint64_t end = buffer.mWritten.load(std::memory_order_acquire);
+            std::uint64_t begin = end > bufferSize ? end - bufferSize : 0;
+            std::vector<TraceEvent> events;
+            events.reserve(end - begin);
+            for (std::uint64_t j = begin; j < end; ++j)
+                events.push_back(buffer.mEvents[j % bufferSize]);
+            // Skip events the owning thread could overwrite while they were copied
+            const std::uint64_t written = buffer.mWritten.load(std::memory_order_acquire);
+            if (written + 1 > bufferSize)
+                begin = std::clamp(written + 1 - bufferSize, begin, end);
+            threads[i].mEvents.assign(events.end() - (end - begin), events.end());
+        }
+
+        stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+        bool first = true;
+        const auto separate = [&] {
+            if (!first)
+                stream << ",\n";
+            first = false;
+        };
+
+        for (const ThreadEvents& thread : threads)
+        {
+            if (!thread.mThreadName.empty())
+            {
+                separate();
+                stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.mThreadId
+                       << ",\"args\":{\"name\":";
+                writeString(stream, thread.mThreadName);
+                stream << "}}";
+            }
+
+            for (const TraceEvent& event : thread.mEvents)
+            {
+                separate();
+                stream << "{\"name\":";
+                writeString(stream, event.mName);
+                stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread.mThreadId
+                       << ",\"ts\":" << toMicroseconds(event.mBegin)
+                       << ",\"dur\":" << toMicroseconds(event.mEnd - event.mBegin) << "}";
+            }
+        }
+
+        stream << "],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    void setTraceFile(const std::filesystem::path& path)
+    {
+        getRegistry().mFile = path;
+    }
+
+    const std::filesystem::path& getTraceFile()
+    {
+        return getRegistry().mFile;
+    }
+
+    bool writeTraceFile()
+    {
+        const std::filesystem::path& path = getTraceFile();
+        std::ofstream stream(path);
+        if (!stream.is_open())
+        {
+            Log(Debug::Error) << "Failed to open trace file " << path;
+            return false;
+        }
+
+        writeTrace(stream);
+
+        if (!stream)
+        {
+            Log(Debug::Error) << "Failed to write trace file " << path;
+            return false;
+        }
+
+        Log(Debug::Info) << "Trace is written to " << path;
+        return true;
+    }
+}
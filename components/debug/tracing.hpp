@@ -0,0 +1,69 @@
+#ifndef OPENMW_COMPONENTS_DEBUG_TRACING_H
+#define OPENMW_COMPONENTS_DEBUG_TRACING_H
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+
+namespace Debug
+{
+    namespace Detail
+    {
+        extern std::atomic_bool sTracing;
+
+        std::int64_t getTraceTime();
+
+        void recordTrace(const char* name, std::int64_t begin, std::int64_t end);
+    }
+
+    // Scopes are recorded into a ring buffer per thread, so only the most recent events of each thread are kept.
+    // Recording from a thread doesn't lock anything, when it's disabled a scope costs a single atomic load.
+    inline bool isTracing()
+    {
+        return Detail::sTracing.load(std::memory_order_relaxed);
+    }
+
+    void setTracing(bool enabled);
+
+    // Name of the calling thread in the written trace.
+    void setTraceThreadName(std::string_view name);
+
+    // Writes recorded events of all threads as Chrome trace events JSON, it can be opened by chrome://tracing or
+    // Perfetto UI. Events recorded while writing may be missing.
+    void writeTrace(std::ostream& stream);
+
+    // File used by the engine to write the trace on demand.
+    void setTraceFile(const std::filesystem::path& path);
+
+    const std::filesystem::path& getTraceFile();
+
+    bool writeTraceFile();
+
+    class ScopedTrace
+    {
+    public:
+        // Name has to outlive the recorded events, usually it's a string literal.
+        explicit ScopedTrace(const char* name)
+            : mName(isTracing() ? name : nullptr)
+            , mBegin(mName == nullptr ? 0 : Detail::getTraceTime())
+        {
+        }
+
+        ScopedTrace(const ScopedTrace&) = delete;
+        ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+        ~ScopedTrace()
+        {
+            if (mName != nullptr)
+                Detail::recordTrace(mName, mBegin, Detail::getTraceTime());
+        }
+
+    private:
+        const char* const mName;
+        const std::int64_t mBegin;
+    };
+}
+
+#endif
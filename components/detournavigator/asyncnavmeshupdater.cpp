@@ -1,6 +1,7 @@
 #include "asyncnavmeshupdater.hpp"
 #include "dbrefgeometryobject.hpp"
 #include "debug.hpp"
+#include "gettilespositions.hpp"
 #include "makenavmesh.hpp"
 #include "navmeshdbutils.hpp"
 #include "serialization.hpp"
@@ -9,6 +10,7 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/misc/compression.hpp>
 #include <components/misc/strings/conversion.hpp>
 #include <components/misc/thread.hpp>
 
@@ -94,7 +96,8 @@ namespace DetourNavigator
             if (db == nullptr)
                 return nullptr;
             return std::make_unique<DbWorker>(updater, std::move(db), TileVersion(navMeshFormatVersion),
-                settings.mRecast, settings.mWriteToNavMeshDb);
+                settings.mRecast, settings.mWriteToNavMeshDb, settings.mMaxDbWriteBatchSize,
+                settings.mMaxDbWriteBatchDelay, settings.mDbReadAheadDistance);
         }
 
         void updateJobs(std::deque<JobIt>& jobs, TilePosition playerTile, int maxTiles)
@@ -221,7 +224,7 @@ namespace DetourNavigator
         lock.unlock();
 
         if (playerTileChanged && mDbWorker != nullptr)
-            mDbWorker->updateJobs(playerTile, maxTiles);
+            mDbWorker->updateJobs(worldspace, playerTile, maxTiles);
     }
 
     void AsyncNavMeshUpdater::wait(WaitConditionType waitConditionType, Loading::Listener* listener)
@@ -720,6 +723,12 @@ namespace DetourNavigator
         std::sort(mJobs.begin(), mJobs.end(), LessByJobDbPriority{});
     }
 
+    bool DbJobQueue::hasWritingJobs() const
+    {
+        const std::lock_guard lock(mMutex);
+        return mWritingJobs > 0;
+    }
+
     void DbJobQueue::stop()
     {
         const std::lock_guard lock(mMutex);
@@ -735,12 +744,16 @@ namespace DetourNavigator
     }
 
     DbWorker::DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db, TileVersion version,
-        const RecastSettings& recastSettings, bool writeToDb)
+        const RecastSettings& recastSettings, bool writeToDb, std::size_t maxWriteBatchSize,
+        std::chrono::milliseconds maxWriteBatchDelay, int readAheadDistance)
         : mUpdater(updater)
         , mRecastSettings(recastSettings)
         , mDb(std::move(db))
         , mVersion(version)
         , mWriteToDb(writeToDb)
+        , mMaxWriteBatchSize(maxWriteBatchSize)
+        , mMaxWriteBatchDelay(maxWriteBatchDelay)
+        , mReadAheadDistance(readAheadDistance)
         , mNextTileId(mDb->getMaxTileId() + 1)
         , mNextShapeId(mDb->getMaxShapeId() + 1)
         , mThread([this] { run(); })
@@ -761,7 +774,23 @@ namespace DetourNavigator
     DbWorkerStats DbWorker::getStats() const
     {
         return DbWorkerStats{ .mJobs = mQueue.getStats(),
-            .mGetTileCount = mGetTileCount.load(std::memory_order_relaxed) };
+            .mGetTileCount = mGetTileCount.load(std::memory_order_relaxed),
+            .mReadAheadHitCount = mReadAheadHitCount.load(std::memory_order_relaxed) };
+    }
+
+    void DbWorker::updateJobs(std::string_view worldspace, TilePosition playerTile, int maxTiles)
+    {
+        mQueue.update(playerTile, maxTiles);
+        if (mReadAheadDistance <= 0)
+            return;
+        const TilePosition distance(mReadAheadDistance, mReadAheadDistance);
+        *mReadAheadRequest.lock() = ReadAheadRequest{
+            .mWorldspace = std::string(worldspace),
+            .mRange = TilesPositionsRange{
+                .mBegin = playerTile - distance,
+                .mEnd = playerTile + distance + TilePosition(1, 1),
+            },
+        };
     }
 
     void DbWorker::stop()
@@ -778,14 +807,17 @@ namespace DetourNavigator
         {
             try
             {
+                readAhead();
                 if (const auto job = mQueue.pop())
                     processJob(*job);
+                commitIfNeeded();
             }
             catch (const std::exception& e)
             {
                 Log(Debug::Error) << "DbWorker exception: " << e.what();
             }
         }
+        commit();
     }
 
     void DbWorker::processJob(JobIt job)
@@ -798,22 +830,8 @@ namespace DetourNavigator
             catch (const std::exception& e)
             {
                 Log(Debug::Error) << "DbWorker exception while processing job " << job->mId << ": " << e.what();
-                if (mWriteToDb)
-                {
-                    const std::string_view message(e.what());
-                    if (message.find("database or disk is full") != std::string_view::npos)
-                    {
-                        mWriteToDb = false;
-                        Log(Debug::Warning)
-                            << "Writes to navmeshdb are disabled because file size limit is reached or disk is full";
-                    }
-                    else if (message.find("database is locked") != std::string_view::npos)
-                    {
-                        mWriteToDb = false;
-                        Log(Debug::Warning)
-                            << "Writes to navmeshdb are disabled to avoid concurrent writes from multiple processes";
-                    }
-                }
+                commit();
+                disableWritesOnError(e.what());
             }
         };
 
@@ -874,6 +892,13 @@ namespace DetourNavigator
             }
         }
 
+        if (auto readAheadTile = findReadAheadTile(*job))
+        {
+            ++mReadAheadHitCount;
+            job->mCachedTileData = std::move(*readAheadTile);
+            return;
+        }
+
         job->mCachedTileData = mDb->getTileData(job->mWorldspace, job->mChangedTile, job->mInput);
     }
 
@@ -896,11 +921,16 @@ namespace DetourNavigator
             job->mInput = serialize(mRecastSettings, job->mAgentBounds, *job->mRecastMesh, objects);
         }
 
+        if (job->mWorldspace == mReadAheadWorldspace)
+            mReadAheadTiles.erase(job->mChangedTile);
+
         if (const auto& cachedTileData = job->mCachedTileData)
         {
             Log(Debug::Debug) << "Update db tile by job " << job->mId;
             job->mGeneratedNavMeshData->mUserId = cachedTileData->mTileId;
+            beginWrite();
             mDb->updateTile(cachedTileData->mTileId, mVersion, serialize(*job->mGeneratedNavMeshData));
+            ++mTransactionWrites;
             return;
         }
 
@@ -913,8 +943,134 @@ namespace DetourNavigator
 
         job->mGeneratedNavMeshData->mUserId = mNextTileId;
         Log(Debug::Debug) << "Insert db tile by job " << job->mId;
+        beginWrite();
         mDb->insertTile(mNextTileId, job->mWorldspace, job->mChangedTile, mVersion, job->mInput,
             serialize(*job->mGeneratedNavMeshData));
         ++mNextTileId;
+        ++mTransactionWrites;
+    }
+
+    void DbWorker::readAhead()
+    {
+        std::optional<ReadAheadRequest> request;
+        std::swap(request, *mReadAheadRequest.lock());
+
+        if (!request.has_value())
+            return;
+
+        TilesPositionsRange excludedRange;
+
+        if (request->mWorldspace == mReadAheadWorldspace)
+        {
+            for (auto it = mReadAheadTiles.begin(); it != mReadAheadTiles.end();)
+            {
+                if (isInTilesPositionsRange(request->mRange, it->first))
+                    ++it;
+                else
+                    it = mReadAheadTiles.erase(it);
+            }
+            excludedRange = mReadAheadRange;
+        }
+        else
+        {
+            mReadAheadTiles.clear();
+            mReadAheadWorldspace = request->mWorldspace;
+        }
+
+        // Tiles from the previous range are already loaded so request only the new ones
+        std::vector<CompressedTile> tiles
+            = mDb->getCompressedTiles(mReadAheadWorldspace, request->mRange, excludedRange);
+
+        getTilesPositions(request->mRange, [&](const TilePosition& position) {
+            if (!isInTilesPositionsRange(excludedRange, position))
+                mReadAheadTiles.emplace(position, std::vector<CompressedTile>());
+        });
+
+        for (CompressedTile& tile : tiles)
+        {
+            const TilePosition position = tile.mTilePosition;
+            mReadAheadTiles[position].push_back(std::move(tile));
+        }
+
+        mReadAheadRange = request->mRange;
+
+        Log(Debug::Debug) << "Read ahead " << tiles.size() << " db tiles around " << request->mRange.mBegin << " .. "
+                          << request->mRange.mEnd;
+    }
+
+    std::optional<std::optional<TileData>> DbWorker::findReadAheadTile(const Job& job)
+    {
+        if (job.mWorldspace != mReadAheadWorldspace)
+            return std::nullopt;
+
+        const auto it = mReadAheadTiles.find(job.mChangedTile);
+        if (it == mReadAheadTiles.end())
+            return std::nullopt;
+
+        const std::vector<std::byte> compressedInput = Misc::compress(job.mInput);
+        for (const CompressedTile& tile : it->second)
+            if (tile.mInput == compressedInput)
+                return TileData{
+                    .mTileId = tile.mTileId,
+                    .mVersion = tile.mVersion,
+                    .mData = Misc::decompress(tile.mData),
+                };
+
+        return std::optional<TileData>();
+    }
+
+    void DbWorker::beginWrite()
+    {
+        if (mTransaction.has_value())
+            return;
+        mTransaction.emplace(mDb->startTransaction(Sqlite3::TransactionMode::Immediate));
+        mTransactionWrites = 0;
+        mTransactionStart = std::chrono::steady_clock::now();
+    }
+
+    void DbWorker::commitIfNeeded()
+    {
+        if (!mTransaction.has_value())
+            return;
+        if (mTransactionWrites < mMaxWriteBatchSize
+            && std::chrono::steady_clock::now() - mTransactionStart < mMaxWriteBatchDelay && mQueue.hasWritingJobs())
+            return;
+        commit();
+    }
+
+    void DbWorker::commit()
+    {
+        if (!mTransaction.has_value())
+            return;
+        Log(Debug::Debug) << "Commit " << mTransactionWrites << " db writes";
+        try
+        {
+            mTransaction->commit();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "DbWorker failed to commit " << mTransactionWrites << " writes: " << e.what();
+            disableWritesOnError(e.what());
+        }
+        mTransaction.reset();
+        mTransactionWrites = 0;
+    }
+
+    void DbWorker::disableWritesOnError(std::string_view message)
+    {
+        if (!mWriteToDb)
+            return;
+        if (message.find("database or disk is full") != std::string_view::npos)
+        {
+            mWriteToDb = false;
+            Log(Debug::Warning)
+                << "Writes to navmeshdb are disabled because file size limit is reached or disk is full";
+        }
+        else if (message.find("database is locked") != std::string_view::npos)
+        {
+            mWriteToDb = false;
+            Log(Debug::Warning)
+                << "Writes to navmeshdb are disabled to avoid concurrent writes from multiple processes";
+        }
     }
 }
@@ -12,6 +12,7 @@
 #include "stats.hpp"
 #include "tilecachedrecastmeshmanager.hpp"
 #include "tileposition.hpp"
+#include "tilespositionsrange.hpp"
 #include "waitconditiontype.hpp"
 
 #include <atomic>
@@ -20,10 +21,13 @@
 #include <deque>
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <tuple>
 
@@ -85,6 +89,8 @@ namespace DetourNavigator
 
         void update(TilePosition playerTile, int maxTiles);
 
+        bool hasWritingJobs() const;
+
         void stop();
 
         DbJobQueueStats getStats() const;
@@ -104,7 +110,8 @@ namespace DetourNavigator
     {
     public:
         DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db, TileVersion version,
-            const RecastSettings& recastSettings, bool writeToDb);
+            const RecastSettings& recastSettings, bool writeToDb, std::size_t maxWriteBatchSize,
+            std::chrono::milliseconds maxWriteBatchDelay, int readAheadDistance);
 
         ~DbWorker();
 
@@ -112,21 +119,39 @@ namespace DetourNavigator
 
         void enqueueJob(JobIt job);
 
-        void updateJobs(TilePosition playerTile, int maxTiles) { mQueue.update(playerTile, maxTiles); }
+        void updateJobs(std::string_view worldspace, TilePosition playerTile, int maxTiles);
 
         void stop();
 
     private:
+        struct ReadAheadRequest
+        {
+            std::string mWorldspace;
+            TilesPositionsRange mRange;
+        };
+
         AsyncNavMeshUpdater& mUpdater;
         const RecastSettings& mRecastSettings;
         const std::unique_ptr<NavMeshDb> mDb;
         const TileVersion mVersion;
         bool mWriteToDb;
+        const std::size_t mMaxWriteBatchSize;
+        const std::chrono::milliseconds mMaxWriteBatchDelay;
+        const int mReadAheadDistance;
         TileId mNextTileId;
         ShapeId mNextShapeId;
         DbJobQueue mQueue;
         std::atomic_bool mShouldStop{ false };
         std::atomic_size_t mGetTileCount{ 0 };
+        std::atomic_size_t mReadAheadHitCount{ 0 };
+        std::optional<Sqlite3::Transaction> mTransaction;
+        std::size_t mTransactionWrites = 0;
+        std::chrono::steady_clock::time_point mTransactionStart;
+        Misc::ScopeGuarded<std::optional<ReadAheadRequest>> mReadAheadRequest;
+        std::string mReadAheadWorldspace;
+        TilesPositionsRange mReadAheadRange;
+        // Tiles loaded in advance around the player. Presence of a key means all tiles for this position are loaded.
+        std::map<TilePosition, std::vector<CompressedTile>> mReadAheadTiles;
         std::thread mThread;
 
         inline void run() noexcept;
@@ -136,6 +161,18 @@ namespace DetourNavigator
         inline void processReadingJob(JobIt job);
 
         inline void processWritingJob(JobIt job);
+
+        inline void readAhead();
+
+        inline std::optional<std::optional<TileData>> findReadAheadTile(const Job& job);
+
+        inline void beginWrite();
+
+        inline void commitIfNeeded();
+
+        inline void commit();
+
+        inline void disableWritesOnError(std::string_view message);
     };
 
     class AsyncNavMeshUpdater
@@ -5,11 +5,16 @@
 #include "preparednavmeshdata.hpp"
 #include "serialization.hpp"
 #include "settings.hpp"
+#include "tileinput.hpp"
 
 #include <components/debug/debuglog.hpp>
 
+#include <extern/smhasher/MurmurHash3.h>
+
 #include <osg/io_utils>
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -32,16 +37,27 @@ namespace DetourNavigator
                     mConsumer->ignore(mWorldspace, mTilePosition);
             }
         };
+
+        std::vector<std::byte> makeTileInputHash(
+            const RecastSettings& settings, const AgentBounds& agentBounds, const TileInput& tileInput)
+        {
+            const std::vector<std::byte> input = serialize(settings, agentBounds, tileInput);
+            const std::array<std::uint64_t, 2> seed{ 0, 0 };
+            std::vector<std::byte> result(sizeof(std::uint64_t) * 2);
+            MurmurHash3_x64_128(input.data(), static_cast<int>(input.size()), seed.data(), result.data());
+            return result;
+        }
     }
 
     GenerateNavMeshTile::GenerateNavMeshTile(std::string worldspace, const TilePosition& tilePosition,
         RecastMeshProvider recastMeshProvider, const AgentBounds& agentBounds,
-        const DetourNavigator::Settings& settings, std::weak_ptr<NavMeshTileConsumer> consumer)
+        const DetourNavigator::Settings& settings, bool useInputHash, std::weak_ptr<NavMeshTileConsumer> consumer)
         : mWorldspace(std::move(worldspace))
         , mTilePosition(tilePosition)
         , mRecastMeshProvider(recastMeshProvider)
         , mAgentBounds(agentBounds)
         , mSettings(settings)
+        , mUseInputHash(useInputHash)
         , mConsumer(std::move(consumer))
     {
     }
@@ -62,10 +78,39 @@ namespace DetourNavigator
         {
             Ignore ignore{ mWorldspace, mTilePosition, consumer };
 
+            std::vector<std::byte> inputHash;
+
+            if (mUseInputHash)
+            {
+                const std::optional<TileInput> tileInput = mRecastMeshProvider.getTileInput(mWorldspace, mTilePosition);
+
+                if (!tileInput.has_value())
+                    return;
+
+                inputHash = makeTileInputHash(mSettings.mRecast, mAgentBounds, *tileInput);
+
+                if (const auto tileId = consumer->findInputHash(mWorldspace, mTilePosition, inputHash))
+                {
+                    if (*tileId == 0)
+                        return;
+                    consumer->identity(mWorldspace, mTilePosition, *tileId);
+                    ignore.mConsumer = nullptr;
+                    return;
+                }
+            }
+
+            const auto setInputHash = [&](std::int64_t tileId) {
+                if (!inputHash.empty())
+                    consumer->setInputHash(mWorldspace, mTilePosition, inputHash, tileId);
+            };
+
             const std::shared_ptr<RecastMesh> recastMesh = mRecastMeshProvider.getMesh(mWorldspace, mTilePosition);
 
             if (recastMesh == nullptr || isEmpty(*recastMesh))
+            {
+                setInputHash(0);
                 return;
+            }
 
             const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(
                 recastMesh->getMeshSources(), [&](const MeshSource& v) { return consumer->resolveMeshSource(v); });
@@ -75,6 +120,7 @@ namespace DetourNavigator
             if (info.has_value() && info->mVersion == navMeshFormatVersion)
             {
                 consumer->identity(mWorldspace, mTilePosition, info->mTileId);
+                setInputHash(info->mTileId);
                 ignore.mConsumer = nullptr;
                 return;
             }
@@ -83,12 +129,18 @@ namespace DetourNavigator
                 = prepareNavMeshTileData(*recastMesh, mWorldspace, mTilePosition, mAgentBounds, mSettings.mRecast);
 
             if (data == nullptr)
+            {
+                setInputHash(0);
                 return;
+            }
 
             if (info.has_value())
+            {
                 consumer->update(mWorldspace, mTilePosition, info->mTileId, navMeshFormatVersion, *data);
+                setInputHash(info->mTileId);
+            }
             else
-                consumer->insert(mWorldspace, mTilePosition, navMeshFormatVersion, input, *data);
+                setInputHash(consumer->insert(mWorldspace, mTilePosition, navMeshFormatVersion, input, *data));
 
             ignore.mConsumer = nullptr;
         }
@@ -42,14 +42,22 @@ namespace DetourNavigator
 
         virtual void identity(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t tileId) = 0;
 
-        virtual void insert(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t version,
-            const std::vector<std::byte>& input, PreparedNavMeshData& data)
+        virtual std::int64_t insert(std::string_view worldspace, const TilePosition& tilePosition,
+            std::int64_t version, const std::vector<std::byte>& input, PreparedNavMeshData& data)
             = 0;
 
         virtual void update(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t tileId,
             std::int64_t version, PreparedNavMeshData& data)
             = 0;
 
+        virtual std::optional<std::int64_t> findInputHash(
+            std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& inputHash)
+            = 0;
+
+        virtual void setInputHash(std::string_view worldspace, const TilePosition& tilePosition,
+            const std::vector<std::byte>& inputHash, std::int64_t tileId)
+            = 0;
+
         virtual void cancel(std::string_view reason) = 0;
     };
 
@@ -58,7 +66,7 @@ namespace DetourNavigator
     public:
         GenerateNavMeshTile(std::string worldspace, const TilePosition& tilePosition,
             RecastMeshProvider recastMeshProvider, const AgentBounds& agentBounds, const Settings& settings,
-            std::weak_ptr<NavMeshTileConsumer> consumer);
+            bool useInputHash, std::weak_ptr<NavMeshTileConsumer> consumer);
 
         void doWork() final;
 
@@ -68,6 +76,7 @@ namespace DetourNavigator
         const RecastMeshProvider mRecastMeshProvider;
         const AgentBounds mAgentBounds;
         const Settings& mSettings;
+        const bool mUseInputHash;
         std::weak_ptr<NavMeshTileConsumer> mConsumer;
 
         inline void impl() noexcept;
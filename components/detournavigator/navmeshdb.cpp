@@ -11,7 +11,10 @@
 #include <sqlite3.h>
 
 #include <cstddef>
+#include <iterator>
+#include <limits>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 namespace DetourNavigator
@@ -48,6 +51,17 @@ namespace DetourNavigator
             CREATE UNIQUE INDEX IF NOT EXISTS index_unique_shapes_by_name_and_type_and_hash
                 ON shapes (name, type, hash);
 
+            CREATE TABLE IF NOT EXISTS tile_input_hashes (
+                worldspace TEXT NOT NULL,
+                tile_position_x INTEGER NOT NULL,
+                tile_position_y INTEGER NOT NULL,
+                hash BLOB NOT NULL,
+                tile_id INTEGER NOT NULL
+            );
+
+            CREATE UNIQUE INDEX IF NOT EXISTS index_unique_tile_input_hashes_by_worldspace_and_tile_position
+                ON tile_input_hashes (worldspace, tile_position_x, tile_position_y);
+
             COMMIT;
         )";
 
@@ -73,6 +87,21 @@ namespace DetourNavigator
                AND input = :input
         )";
 
+        constexpr std::string_view getCompressedTilesQuery = R"(
+            SELECT tile_id, version, tile_position_x, tile_position_y, input, data
+              FROM tiles
+             WHERE worldspace = :worldspace
+               AND tile_position_x >= :begin_tile_position_x
+               AND tile_position_y >= :begin_tile_position_y
+               AND tile_position_x < :end_tile_position_x
+               AND tile_position_y < :end_tile_position_y
+               AND NOT (    tile_position_x >= :begin_excluded_tile_position_x
+                        AND tile_position_y >= :begin_excluded_tile_position_y
+                        AND tile_position_x < :end_excluded_tile_position_x
+                        AND tile_position_y < :end_excluded_tile_position_y
+                       )
+        )";
+
         constexpr std::string_view insertTileQuery = R"(
             INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,  data)
                    VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input, :data)
@@ -111,6 +140,33 @@ namespace DetourNavigator
                    )
         )";
 
+        constexpr std::string_view findTileInputHashQuery = R"(
+            SELECT tile_input_hashes.tile_id
+              FROM tile_input_hashes
+             WHERE tile_input_hashes.worldspace = :worldspace
+               AND tile_input_hashes.tile_position_x = :tile_position_x
+               AND tile_input_hashes.tile_position_y = :tile_position_y
+               AND tile_input_hashes.hash = :hash
+               AND (   tile_input_hashes.tile_id = 0
+                    OR EXISTS (SELECT 1 FROM tiles WHERE tiles.tile_id = tile_input_hashes.tile_id)
+                   )
+        )";
+
+        constexpr std::string_view insertTileInputHashQuery = R"(
+            INSERT OR REPLACE INTO tile_input_hashes ( worldspace,  tile_position_x,  tile_position_y,  hash,  tile_id)
+                   VALUES                            (:worldspace, :tile_position_x, :tile_position_y, :hash, :tile_id)
+        )";
+
+        constexpr std::string_view deleteTileInputHashesOutsideRangeQuery = R"(
+            DELETE FROM tile_input_hashes
+             WHERE worldspace = :worldspace
+               AND (   tile_position_x < :begin_tile_position_x
+                    OR tile_position_y < :begin_tile_position_y
+                    OR tile_position_x >= :end_tile_position_x
+                    OR tile_position_y >= :end_tile_position_y
+                   )
+        )";
+
         constexpr std::string_view getMaxShapeIdQuery = R"(
             SELECT max(shape_id) FROM shapes
         )";
@@ -171,11 +227,15 @@ namespace DetourNavigator
         , mGetMaxTileId(*mDb, DbQueries::GetMaxTileId{})
         , mFindTile(*mDb, DbQueries::FindTile{})
         , mGetTileData(*mDb, DbQueries::GetTileData{})
+        , mGetCompressedTiles(*mDb, DbQueries::GetCompressedTiles{})
         , mInsertTile(*mDb, DbQueries::InsertTile{})
         , mUpdateTile(*mDb, DbQueries::UpdateTile{})
         , mDeleteTilesAt(*mDb, DbQueries::DeleteTilesAt{})
         , mDeleteTilesAtExcept(*mDb, DbQueries::DeleteTilesAtExcept{})
         , mDeleteTilesOutsideRange(*mDb, DbQueries::DeleteTilesOutsideRange{})
+        , mFindTileInputHash(*mDb, DbQueries::FindTileInputHash{})
+        , mInsertTileInputHash(*mDb, DbQueries::InsertTileInputHash{})
+        , mDeleteTileInputHashesOutsideRange(*mDb, DbQueries::DeleteTileInputHashesOutsideRange{})
         , mGetMaxShapeId(*mDb, DbQueries::GetMaxShapeId{})
         , mFindShapeId(*mDb, DbQueries::FindShapeId{})
         , mInsertShape(*mDb, DbQueries::InsertShape{})
@@ -222,6 +282,25 @@ namespace DetourNavigator
         return result;
     }
 
+    std::vector<CompressedTile> NavMeshDb::getCompressedTiles(
+        std::string_view worldspace, const TilesPositionsRange& range, const TilesPositionsRange& excludedRange)
+    {
+        std::vector<std::tuple<TileId, TileVersion, int, int, std::vector<std::byte>, std::vector<std::byte>>> rows;
+        request(*mDb, mGetCompressedTiles, std::back_inserter(rows), std::numeric_limits<std::size_t>::max(),
+            worldspace, range, excludedRange);
+        std::vector<CompressedTile> result;
+        result.reserve(rows.size());
+        for (auto& [tileId, version, x, y, input, data] : rows)
+            result.push_back(CompressedTile{
+                .mTileId = tileId,
+                .mVersion = version,
+                .mTilePosition = TilePosition(x, y),
+                .mInput = std::move(input),
+                .mData = std::move(data),
+            });
+        return result;
+    }
+
     int NavMeshDb::insertTile(TileId tileId, std::string_view worldspace, const TilePosition& tilePosition,
         TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data)
     {
@@ -252,6 +331,26 @@ namespace DetourNavigator
         return execute(*mDb, mDeleteTilesOutsideRange, worldspace, range);
     }
 
+    std::optional<TileId> NavMeshDb::findTileInputHash(
+        std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& hash)
+    {
+        TileId tileId;
+        if (&tileId == request(*mDb, mFindTileInputHash, &tileId, 1, worldspace, tilePosition, hash))
+            return {};
+        return tileId;
+    }
+
+    int NavMeshDb::insertTileInputHash(std::string_view worldspace, const TilePosition& tilePosition,
+        const std::vector<std::byte>& hash, TileId tileId)
+    {
+        return execute(*mDb, mInsertTileInputHash, worldspace, tilePosition, hash, tileId);
+    }
+
+    int NavMeshDb::deleteTileInputHashesOutsideRange(std::string_view worldspace, const TilesPositionsRange& range)
+    {
+        return execute(*mDb, mDeleteTileInputHashesOutsideRange, worldspace, range);
+    }
+
     ShapeId NavMeshDb::getMaxShapeId()
     {
         ShapeId shapeId{ 0 };
@@ -312,6 +411,25 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":input", input);
         }
 
+        std::string_view GetCompressedTiles::text() noexcept
+        {
+            return getCompressedTilesQuery;
+        }
+
+        void GetCompressedTiles::bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+            const TilesPositionsRange& range, const TilesPositionsRange& excludedRange)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_x", range.mBegin.x());
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_y", range.mBegin.y());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_x", range.mEnd.x());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_y", range.mEnd.y());
+            Sqlite3::bindParameter(db, statement, ":begin_excluded_tile_position_x", excludedRange.mBegin.x());
+            Sqlite3::bindParameter(db, statement, ":begin_excluded_tile_position_y", excludedRange.mBegin.y());
+            Sqlite3::bindParameter(db, statement, ":end_excluded_tile_position_x", excludedRange.mEnd.x());
+            Sqlite3::bindParameter(db, statement, ":end_excluded_tile_position_y", excludedRange.mEnd.y());
+        }
+
         std::string_view InsertTile::text() noexcept
         {
             return insertTileQuery;
@@ -385,6 +503,50 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":end_tile_position_y", range.mEnd.y());
         }
 
+        std::string_view FindTileInputHash::text() noexcept
+        {
+            return findTileInputHashQuery;
+        }
+
+        void FindTileInputHash::bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+            const TilePosition& tilePosition, const std::vector<std::byte>& hash)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":tile_position_x", tilePosition.x());
+            Sqlite3::bindParameter(db, statement, ":tile_position_y", tilePosition.y());
+            Sqlite3::bindParameter(db, statement, ":hash", hash);
+        }
+
+        std::string_view InsertTileInputHash::text() noexcept
+        {
+            return insertTileInputHashQuery;
+        }
+
+        void InsertTileInputHash::bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+            const TilePosition& tilePosition, const std::vector<std::byte>& hash, TileId tileId)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":tile_position_x", tilePosition.x());
+            Sqlite3::bindParameter(db, statement, ":tile_position_y", tilePosition.y());
+            Sqlite3::bindParameter(db, statement, ":hash", hash);
+            Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
+        }
+
+        std::string_view DeleteTileInputHashesOutsideRange::text() noexcept
+        {
+            return deleteTileInputHashesOutsideRangeQuery;
+        }
+
+        void DeleteTileInputHashesOutsideRange::bind(
+            sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilesPositionsRange& range)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_x", range.mBegin.x());
+            Sqlite3::bindParameter(db, statement, ":begin_tile_position_y", range.mBegin.y());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_x", range.mEnd.x());
+            Sqlite3::bindParameter(db, statement, ":end_tile_position_y", range.mEnd.y());
+        }
+
         std::string_view GetMaxShapeId::text() noexcept
         {
             return getMaxShapeIdQuery;
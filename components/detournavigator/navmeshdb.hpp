@@ -45,6 +45,16 @@ namespace DetourNavigator
         std::vector<std::byte> mData;
     };
 
+    // Tile with input and data as they are stored in the db
+    struct CompressedTile
+    {
+        TileId mTileId;
+        TileVersion mVersion;
+        TilePosition mTilePosition;
+        std::vector<std::byte> mInput;
+        std::vector<std::byte> mData;
+    };
+
     enum class ShapeType
     {
         Collision = 1,
@@ -75,6 +85,13 @@ namespace DetourNavigator
                 const TilePosition& tilePosition, const std::vector<std::byte>& input);
         };
 
+        struct GetCompressedTiles
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+                const TilesPositionsRange& range, const TilesPositionsRange& excludedRange);
+        };
+
         struct InsertTile
         {
             static std::string_view text() noexcept;
@@ -111,6 +128,27 @@ namespace DetourNavigator
                 sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilesPositionsRange& range);
         };
 
+        struct FindTileInputHash
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+                const TilePosition& tilePosition, const std::vector<std::byte>& hash);
+        };
+
+        struct InsertTileInputHash
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace,
+                const TilePosition& tilePosition, const std::vector<std::byte>& hash, TileId tileId);
+        };
+
+        struct DeleteTileInputHashesOutsideRange
+        {
+            static std::string_view text() noexcept;
+            static void bind(
+                sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilesPositionsRange& range);
+        };
+
         struct GetMaxShapeId
         {
             static std::string_view text() noexcept;
@@ -153,6 +191,10 @@ namespace DetourNavigator
         std::optional<TileData> getTileData(
             std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input);
 
+        // Returns all tiles within the range except ones inside excluded range without decompression
+        std::vector<CompressedTile> getCompressedTiles(
+            std::string_view worldspace, const TilesPositionsRange& range, const TilesPositionsRange& excludedRange);
+
         int insertTile(TileId tileId, std::string_view worldspace, const TilePosition& tilePosition,
             TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data);
 
@@ -164,6 +206,16 @@ namespace DetourNavigator
 
         int deleteTilesOutsideRange(std::string_view worldspace, const TilesPositionsRange& range);
 
+        // Returns id of the tile generated from the input with given hash. Zero tile id means there was nothing to
+        // generate. Returns std::nullopt when there is no record for given hash or the tile is already removed.
+        std::optional<TileId> findTileInputHash(
+            std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& hash);
+
+        int insertTileInputHash(std::string_view worldspace, const TilePosition& tilePosition,
+            const std::vector<std::byte>& hash, TileId tileId);
+
+        int deleteTileInputHashesOutsideRange(std::string_view worldspace, const TilesPositionsRange& range);
+
         ShapeId getMaxShapeId();
 
         std::optional<ShapeId> findShapeId(std::string_view name, ShapeType type, const Sqlite3::ConstBlob& hash);
@@ -177,11 +229,15 @@ namespace DetourNavigator
         Sqlite3::Statement<DbQueries::GetMaxTileId> mGetMaxTileId;
         Sqlite3::Statement<DbQueries::FindTile> mFindTile;
         Sqlite3::Statement<DbQueries::GetTileData> mGetTileData;
+        Sqlite3::Statement<DbQueries::GetCompressedTiles> mGetCompressedTiles;
         Sqlite3::Statement<DbQueries::InsertTile> mInsertTile;
         Sqlite3::Statement<DbQueries::UpdateTile> mUpdateTile;
         Sqlite3::Statement<DbQueries::DeleteTilesAt> mDeleteTilesAt;
         Sqlite3::Statement<DbQueries::DeleteTilesAtExcept> mDeleteTilesAtExcept;
         Sqlite3::Statement<DbQueries::DeleteTilesOutsideRange> mDeleteTilesOutsideRange;
+        Sqlite3::Statement<DbQueries::FindTileInputHash> mFindTileInputHash;
+        Sqlite3::Statement<DbQueries::InsertTileInputHash> mInsertTileInputHash;
+        Sqlite3::Statement<DbQueries::DeleteTileInputHashesOutsideRange> mDeleteTileInputHashesOutsideRange;
         Sqlite3::Statement<DbQueries::GetMaxShapeId> mGetMaxShapeId;
         Sqlite3::Statement<DbQueries::FindShapeId> mFindShapeId;
         Sqlite3::Statement<DbQueries::InsertShape> mInsertShape;
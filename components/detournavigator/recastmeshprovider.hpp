@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 namespace DetourNavigator
 {
@@ -25,6 +26,11 @@ namespace DetourNavigator
             return mImpl.get().getNewMesh(worldspace, tilePosition);
         }
 
+        std::optional<TileInput> getTileInput(std::string_view worldspace, const TilePosition& tilePosition) const
+        {
+            return mImpl.get().getTileInput(worldspace, tilePosition);
+        }
+
     private:
         std::reference_wrapper<TileCachedRecastMeshManager> mImpl;
     };
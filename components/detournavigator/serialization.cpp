@@ -7,6 +7,7 @@
 #include "recastmesh.hpp"
 #include "settings.hpp"
 #include "tilebounds.hpp"
+#include "tileinput.hpp"
 
 #include <components/serialization/binaryreader.hpp>
 #include <components/serialization/binarywriter.hpp>
@@ -15,7 +16,9 @@
 
 #include <cstddef>
 #include <cstring>
+#include <string>
 #include <type_traits>
+#include <variant>
 #include <vector>
 
 namespace DetourNavigator
@@ -149,6 +152,61 @@ namespace DetourNavigator
                 visitor(*this, dbRefGeometryObjects);
             }
 
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const std::string& value) const
+            {
+                visitor(*this, static_cast<std::uint64_t>(value.size()));
+                visitor(*this, value.data(), value.size());
+            }
+
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const HeightfieldPlane& value) const
+            {
+                visitor(*this, value.mHeight);
+            }
+
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const HeightfieldSurface& value) const
+            {
+                visitor(*this, static_cast<std::uint64_t>(value.mSize));
+                visitor(*this, value.mMinHeight);
+                visitor(*this, value.mMaxHeight);
+                visitor(*this, value.mHeights, value.mSize * value.mSize);
+            }
+
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const TileInputHeightfield& value) const
+            {
+                visitor(*this, value.mCellPosition);
+                visitor(*this, value.mCellSize);
+                visitor(*this, static_cast<std::uint32_t>(value.mShape.index()));
+                std::visit([&](const auto& shape) { visitor(*this, shape); }, value.mShape);
+            }
+
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const MeshSource& value) const
+            {
+                visitor(*this, value.mShape->mFileName);
+                visitor(*this, value.mShape->mFileHash);
+                visitor(*this, value.mObjectTransform);
+                visitor(*this, value.mAreaType);
+            }
+
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const RecastSettings& settings, const AgentBounds& agentBounds,
+                const TileInput& tileInput) const
+            {
+                visitor(*this, DetourNavigator::tileInputMagic);
+                visitor(*this, DetourNavigator::tileInputVersion);
+                visitor(*this, DetourNavigator::recastMeshVersion);
+                visitor(*this, DetourNavigator::navMeshFormatVersion);
+                visitor(*this, settings);
+                visitor(*this, agentBounds);
+                visitor(*this, tileInput.mWater);
+                visitor(*this, tileInput.mHeightfields);
+                visitor(*this, tileInput.mSources);
+            }
+
             template <class Visitor, class T>
             auto operator()(Visitor&& visitor, T& value) const
                 -> std::enable_if_t<std::is_same_v<std::decay_t<T>, rcPolyMesh>>
@@ -256,6 +314,18 @@ namespace DetourNavigator
         return result;
     }
 
+    std::vector<std::byte> serialize(
+        const RecastSettings& settings, const AgentBounds& agentBounds, const TileInput& tileInput)
+    {
+        constexpr Format<Serialization::Mode::Write> format;
+        Serialization::SizeAccumulator sizeAccumulator;
+        format(sizeAccumulator, settings, agentBounds, tileInput);
+        std::vector<std::byte> result(sizeAccumulator.value());
+        format(Serialization::BinaryWriter(result.data(), result.data() + result.size()), settings, agentBounds,
+            tileInput);
+        return result;
+    }
+
     std::vector<std::byte> serialize(const PreparedNavMeshData& value)
     {
         constexpr Format<Serialization::Mode::Write> format;
@@ -12,6 +12,7 @@ namespace DetourNavigator
     struct PreparedNavMeshData;
     struct RecastSettings;
     struct AgentBounds;
+    struct TileInput;
 
     constexpr char recastMeshMagic[] = { 'r', 'c', 's', 't' };
     constexpr std::uint32_t recastMeshVersion = 2;
@@ -22,6 +23,12 @@ namespace DetourNavigator
     std::vector<std::byte> serialize(const RecastSettings& settings, const AgentBounds& agentBounds,
         const RecastMesh& recastMesh, const std::vector<DbRefGeometryObject>& dbRefGeometryObjects);
 
+    constexpr char tileInputMagic[] = { 't', 'i', 'n', 'p' };
+    constexpr std::uint32_t tileInputVersion = 1;
+
+    std::vector<std::byte> serialize(
+        const RecastSettings& settings, const AgentBounds& agentBounds, const TileInput& tileInput);
+
     std::vector<std::byte> serialize(const PreparedNavMeshData& value);
 
     bool deserialize(const std::vector<std::byte>& data, PreparedNavMeshData& value);
@@ -60,6 +60,10 @@ namespace DetourNavigator
         result.mEnableNavMeshDiskCache = ::Settings::navigator().mEnableNavMeshDiskCache;
         result.mWriteToNavMeshDb = ::Settings::navigator().mWriteToNavmeshdb;
         result.mMaxDbFileSize = ::Settings::navigator().mMaxNavmeshdbFileSize;
+        result.mMaxDbWriteBatchSize = ::Settings::navigator().mMaxNavmeshdbWriteBatchSize;
+        result.mMaxDbWriteBatchDelay
+            = std::chrono::milliseconds(::Settings::navigator().mMaxNavmeshdbWriteBatchDelayMs);
+        result.mDbReadAheadDistance = ::Settings::navigator().mNavmeshdbReadAheadDistance;
 
         return result;
     }
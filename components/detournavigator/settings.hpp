@@ -51,6 +51,9 @@ namespace DetourNavigator
         std::string mNavMeshPathPrefix;
         std::chrono::milliseconds mMinUpdateInterval;
         std::uint64_t mMaxDbFileSize = 0;
+        std::size_t mMaxDbWriteBatchSize = 1;
+        std::chrono::milliseconds mMaxDbWriteBatchDelay{ 0 };
+        int mDbReadAheadDistance = 0;
     };
 
     inline constexpr std::int64_t navMeshFormatVersion = 2;
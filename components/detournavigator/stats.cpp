@@ -22,6 +22,8 @@ namespace DetourNavigator
 
                 out.setAttribute(frameNumber, "NavMesh DbCache Get", static_cast<double>(stats.mDb->mGetTileCount));
                 out.setAttribute(frameNumber, "NavMesh DbCache Hit", static_cast<double>(stats.mDbGetTileHits));
+                out.setAttribute(
+                    frameNumber, "NavMesh DbAhead Hit", static_cast<double>(stats.mDb->mReadAheadHitCount));
             }
 
             out.setAttribute(frameNumber, "NavMesh CacheSize", static_cast<double>(stats.mCache.mNavMeshCacheSize));
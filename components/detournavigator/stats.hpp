@@ -21,6 +21,7 @@ namespace DetourNavigator
     {
         DbJobQueueStats mJobs;
         std::size_t mGetTileCount = 0;
+        std::size_t mReadAheadHitCount = 0;
     };
 
     struct NavMeshTilesCacheStats
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <tuple>
 #include <vector>
 
 namespace DetourNavigator
@@ -369,6 +370,63 @@ namespace DetourNavigator
         return makeMesh(tilePosition);
     }
 
+    std::optional<TileInput> TileCachedRecastMeshManager::getTileInput(
+        std::string_view worldspace, const TilePosition& tilePosition) const
+    {
+        TileInput result;
+        {
+            const std::lock_guard lock(mMutex);
+            if (mWorldspace != worldspace)
+                return std::nullopt;
+            for (auto it = mWaterIndex.qbegin(makeIndexQuery(tilePosition)); it != mWaterIndex.qend(); ++it)
+            {
+                const auto& [cellPosition, data] = *it->second;
+                result.mWater.push_back(CellWater{ .mCellPosition = cellPosition, .mWater = data.mWater });
+            }
+            for (auto it = mHeightfieldIndex.qbegin(makeIndexQuery(tilePosition)); it != mHeightfieldIndex.qend(); ++it)
+            {
+                const auto& [cellPosition, data] = *it->second;
+                result.mHeightfields.push_back(TileInputHeightfield{
+                    .mCellPosition = cellPosition,
+                    .mCellSize = data.mCellSize,
+                    .mShape = data.mShape,
+                });
+            }
+            for (auto it = mObjectIndex.qbegin(makeIndexQuery(tilePosition)); it != mObjectIndex.qend(); ++it)
+            {
+                const auto& object = it->second->mObject;
+                result.mSources.push_back(MeshSource{
+                    .mShape = object.getInstance()->getSource(),
+                    .mObjectTransform = object.getObjectTransform(),
+                    .mAreaType = object.getAreaType(),
+                });
+            }
+            if (result.mWater.empty() && result.mHeightfields.empty() && result.mSources.empty())
+                return std::nullopt;
+            if (mInfiniteWater != mWater.end())
+                result.mWater.push_back(
+                    CellWater{ .mCellPosition = mInfiniteWater->first, .mWater = mInfiniteWater->second.mWater });
+            if (mInfiniteHeightfield != mHeightfields.end())
+                result.mHeightfields.push_back(TileInputHeightfield{
+                    .mCellPosition = mInfiniteHeightfield->first,
+                    .mCellSize = mInfiniteHeightfield->second.mCellSize,
+                    .mShape = mInfiniteHeightfield->second.mShape,
+                });
+        }
+        // Index iteration order depends on the order of insertion so make it stable to get the same hash for the same
+        // set of inputs.
+        std::sort(result.mWater.begin(), result.mWater.end());
+        std::sort(result.mHeightfields.begin(), result.mHeightfields.end(),
+            [](const TileInputHeightfield& l, const TileInputHeightfield& r) {
+                return l.mCellPosition < r.mCellPosition;
+            });
+        std::sort(result.mSources.begin(), result.mSources.end(), [](const MeshSource& l, const MeshSource& r) {
+            return std::tie(l.mShape->mFileName, l.mShape->mFileHash, l.mObjectTransform, l.mAreaType)
+                < std::tie(r.mShape->mFileName, r.mShape->mFileHash, r.mObjectTransform, r.mAreaType);
+        });
+        return result;
+    }
+
     void TileCachedRecastMeshManager::reportNavMeshChange(
         const TilePosition& tilePosition, Version recastMeshVersion, Version navMeshVersion)
     {
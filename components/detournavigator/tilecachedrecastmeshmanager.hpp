@@ -9,6 +9,7 @@
 #include "objectid.hpp"
 #include "recastmesh.hpp"
 #include "recastmeshobject.hpp"
+#include "tileinput.hpp"
 #include "tileposition.hpp"
 #include "updateguard.hpp"
 #include "version.hpp"
@@ -73,6 +74,8 @@ namespace DetourNavigator
 
         std::shared_ptr<RecastMesh> getNewMesh(std::string_view worldspace, const TilePosition& tilePosition) const;
 
+        std::optional<TileInput> getTileInput(std::string_view worldspace, const TilePosition& tilePosition) const;
+
         std::size_t getRevision() const { return mRevision; }
 
         void reportNavMeshChange(const TilePosition& tilePosition, Version recastMeshVersion, Version navMeshVersion);
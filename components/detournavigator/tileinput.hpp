@@ -0,0 +1,30 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_TILEINPUT_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_TILEINPUT_H
+
+#include "heightfieldshape.hpp"
+#include "recastmesh.hpp"
+
+#include <osg/Vec2i>
+
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct TileInputHeightfield
+    {
+        osg::Vec2i mCellPosition;
+        int mCellSize;
+        HeightfieldShape mShape;
+    };
+
+    // Describes everything that goes into a recast mesh for a tile without building it. Used to detect whether
+    // a tile has to be generated again by comparing hashes of the input.
+    struct TileInput
+    {
+        std::vector<CellWater> mWater;
+        std::vector<TileInputHeightfield> mHeightfields;
+        std::vector<MeshSource> mSources;
+    };
+}
+
+#endif
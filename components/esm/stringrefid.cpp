@@ -1,7 +1,9 @@
 #include "stringrefid.hpp"
 #include "serializerefid.hpp"
 
+#include <array>
 #include <charconv>
+#include <cstdint>
 #include <iomanip>
 #include <mutex>
 #include <ostream>
@@ -9,7 +11,6 @@
 #include <system_error>
 #include <unordered_set>
 
-#include "components/misc/guarded.hpp"
 #include "components/misc/strings/algorithm.hpp"
 #include "components/misc/utf8stream.hpp"
 
@@ -17,23 +18,106 @@ namespace ESM
 {
     namespace
     {
-        using StringsSet = std::unordered_set<std::string, Misc::StringUtils::CiHash, Misc::StringUtils::CiEqual>;
-
         const std::string emptyString;
 
-        Misc::ScopeGuarded<StringsSet>& getRefIds()
+        // Hash is computed once per lookup and stored with the string to be used by the set and the thread cache
+        struct HashedString
+        {
+            std::string_view mValue;
+            std::size_t mHash;
+        };
+
+        struct StoredString
+        {
+            std::string mValue;
+            std::size_t mHash;
+        };
+
+        struct StoredStringHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(const HashedString& value) const noexcept { return value.mHash; }
+
+            std::size_t operator()(const StoredString& value) const noexcept { return value.mHash; }
+        };
+
+        struct StoredStringEqual
+        {
+            using is_transparent = void;
+
+            template <class L, class R>
+            bool operator()(const L& l, const R& r) const noexcept
+            {
+                return l.mHash == r.mHash && Misc::StringUtils::ciEqual(l.mValue, r.mValue);
+            }
+        };
+
+        using StringsSet = std::unordered_set<StoredString, StoredStringHash, StoredStringEqual>;
+
+        // Strings are never removed and set elements don't move, so pointers to them are valid forever. Strings are
+        // distributed over the shards by hash to let different threads insert and find them independently.
+        struct alignas(64) Shard
         {
-            static Misc::ScopeGuarded<StringsSet> refIds;
-            return refIds;
+            std::mutex mMutex;
+            StringsSet mStrings;
+        };
+
+        constexpr std::size_t shardsCountBits = 4;
+
+        std::array<Shard, 1 << shardsCountBits>& getShards()
+        {
+            static std::array<Shard, 1 << shardsCountBits> shards;
+            return shards;
+        }
+
+        HashedString makeHashedString(std::string_view value)
+        {
+            return HashedString{ value, Misc::StringUtils::CiHash{}(value) };
         }
 
+        Shard& getShard(const HashedString& value)
+        {
+            // Use high bits of the mixed hash to keep low bits distributed within a shard
+            const std::uint64_t mixed = static_cast<std::uint64_t>(value.mHash) * 0x9E3779B97F4A7C15ull;
+            return getShards()[static_cast<std::size_t>(mixed >> (64 - shardsCountBits))];
+        }
+
+        const std::string* findString(const HashedString& value)
+        {
+            Shard& shard = getShard(value);
+            const std::lock_guard lock(shard.mMutex);
+            const auto it = shard.mStrings.find(value);
+            if (it == shard.mStrings.end())
+                return nullptr;
+            return &it->mValue;
+        }
+
+        // Recently used strings of a thread, allows to avoid locking a shard for the same ids
+        struct CachedString
+        {
+            std::size_t mHash = 0;
+            const std::string* mValue = nullptr;
+        };
+
+        thread_local std::array<CachedString, 256> cachedStrings;
+
         Misc::NotNullPtr<const std::string> getOrInsertString(std::string_view id)
         {
-            const auto locked = getRefIds().lock();
-            auto it = locked->find(id);
-            if (it == locked->end())
-                it = locked->emplace(id).first;
-            return &*it;
+            const HashedString value = makeHashedString(id);
+            CachedString& cached = cachedStrings[value.mHash % cachedStrings.size()];
+            if (cached.mValue != nullptr && cached.mHash == value.mHash
+                && Misc::StringUtils::ciEqual(*cached.mValue, id))
+                return cached.mValue;
+
+            Shard& shard = getShard(value);
+            const std::lock_guard lock(shard.mMutex);
+            auto it = shard.mStrings.find(value);
+            if (it == shard.mStrings.end())
+                it = shard.mStrings.insert(StoredString{ std::string(id), value.mHash }).first;
+
+            cached = CachedString{ value.mHash, &it->mValue };
+            return &it->mValue;
         }
 
         void addHex(unsigned char value, std::string& result)
@@ -137,12 +221,11 @@ namespace ESM
 
     std::optional<StringRefId> StringRefId::deserializeExisting(std::string_view value)
     {
-        const auto locked = getRefIds().lock();
-        auto it = locked->find(value);
-        if (it == locked->end())
+        const std::string* const existing = findString(makeHashedString(value));
+        if (existing == nullptr)
             return {};
         StringRefId id;
-        id.mValue = &*it;
+        id.mValue = existing;
         return id;
     }
 }
@@ -129,7 +129,7 @@ namespace ESM
 
     void ESMReader::openRaw(const std::filesystem::path& filename)
     {
-        openRaw(Files::openBinaryInputFileStream(filename), filename);
+        openRaw(Files::openMappedInputFileStream(filename), filename);
     }
 
     void ESMReader::open(std::unique_ptr<std::istream>&& stream, const std::filesystem::path& name)
@@ -146,7 +146,7 @@ namespace ESM
 
     void ESMReader::open(const std::filesystem::path& file)
     {
-        open(Files::openBinaryInputFileStream(file), file);
+        open(Files::openMappedInputFileStream(file), file);
     }
 
     std::string ESMReader::getHNOString(NAME name)
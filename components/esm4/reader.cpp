@@ -25,12 +25,16 @@
 #undef DEBUG_GROUPSTACK
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 
 #include <zlib.h>
 
@@ -158,6 +162,175 @@ namespace ESM4
         }
     }
 
+    // Scans record headers of the file using own stream and decompresses compressed records on worker threads
+    // keeping a limited number of them ahead of the reader. Decompressed records are taken in the file order,
+    // the ones skipped by the reader are dropped.
+    class RecordPrefetcher
+    {
+    public:
+        RecordPrefetcher(Files::IStreamPtr&& stream, std::size_t recHeaderSize, std::size_t threads)
+            : mStream(std::move(stream))
+            , mRecHeaderSize(recHeaderSize)
+            , mMaxRecords(threads * 64)
+        {
+            mThreads.reserve(threads + 1);
+            mThreads.emplace_back([this] { scan(); });
+            for (std::size_t i = 0; i < threads; ++i)
+                mThreads.emplace_back([this] { decompressRecords(); });
+        }
+
+        ~RecordPrefetcher()
+        {
+            {
+                const std::lock_guard lock(mMutex);
+                mStopped = true;
+            }
+            mHasSpace.notify_all();
+            mHasPending.notify_all();
+            for (std::thread& thread : mThreads)
+                thread.join();
+        }
+
+        // Returns nullptr when the record at the position was not prefetched
+        std::unique_ptr<Bsa::MemoryInputStream> take(std::streamoff position)
+        {
+            std::unique_lock lock(mMutex);
+            while (true)
+            {
+                while (!mRecords.empty() && mRecords.front()->mPosition < position)
+                    popFront();
+                if (!mRecords.empty())
+                {
+                    Record& record = *mRecords.front();
+                    if (record.mPosition != position)
+                        return nullptr;
+                    if (record.mDone)
+                    {
+                        const std::shared_ptr<Record> result = mRecords.front();
+                        popFront();
+                        if (result->mError != nullptr)
+                            std::rethrow_exception(result->mError);
+                        return std::move(result->mResult);
+                    }
+                }
+                else if (mScanDone)
+                    return nullptr;
+                mHasDone.wait(lock);
+            }
+        }
+
+    private:
+        struct Record
+        {
+            std::streamoff mPosition;
+            std::vector<char> mCompressed;
+            std::uint32_t mUncompressedSize;
+            bool mDone = false;
+            std::unique_ptr<Bsa::MemoryInputStream> mResult;
+            std::exception_ptr mError;
+        };
+
+        Files::IStreamPtr mStream;
+        const std::size_t mRecHeaderSize;
+        const std::size_t mMaxRecords;
+        std::mutex mMutex;
+        std::condition_variable mHasSpace;
+        std::condition_variable mHasPending;
+        std::condition_variable mHasDone;
+        std::deque<std::shared_ptr<Record>> mRecords;
+        std::deque<std::shared_ptr<Record>> mPending;
+        bool mScanDone = false;
+        bool mStopped = false;
+        std::vector<std::thread> mThreads;
+
+        void popFront()
+        {
+            mRecords.pop_front();
+            mHasSpace.notify_one();
+        }
+
+        void scan()
+        {
+            try
+            {
+                RecordHeader header{};
+                // Groups are not skipped, their records follow the group header
+                while (mStream->read(reinterpret_cast<char*>(&header), mRecHeaderSize))
+                {
+                    if (header.record.typeId == REC_GRUP)
+                        continue;
+
+                    if ((header.record.flags & Rec_Compressed) == 0 || header.record.dataSize < sizeof(std::uint32_t))
+                    {
+                        mStream->seekg(header.record.dataSize, std::ios_base::cur);
+                        continue;
+                    }
+
+                    auto record = std::make_shared<Record>();
+                    mStream->read(reinterpret_cast<char*>(&record->mUncompressedSize), sizeof(std::uint32_t));
+                    record->mPosition = mStream->tellg();
+                    record->mCompressed.resize(header.record.dataSize - sizeof(std::uint32_t));
+                    if (!mStream->read(record->mCompressed.data(), record->mCompressed.size()))
+                        break;
+
+                    std::unique_lock lock(mMutex);
+                    mHasSpace.wait(lock, [&] { return mStopped || mRecords.size() < mMaxRecords; });
+                    if (mStopped)
+                        return;
+                    mRecords.push_back(record);
+                    mPending.push_back(std::move(record));
+                    mHasPending.notify_one();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to prefetch ESM4 records: " << e.what();
+            }
+
+            {
+                const std::lock_guard lock(mMutex);
+                mScanDone = true;
+            }
+            mHasDone.notify_all();
+        }
+
+        void decompressRecords()
+        {
+            while (true)
+            {
+                std::shared_ptr<Record> record;
+                {
+                    std::unique_lock lock(mMutex);
+                    mHasPending.wait(lock, [&] { return mStopped || !mPending.empty(); });
+                    if (mStopped)
+                        return;
+                    record = std::move(mPending.front());
+                    mPending.pop_front();
+                }
+
+                std::unique_ptr<Bsa::MemoryInputStream> result;
+                std::exception_ptr error;
+                try
+                {
+                    result = decompress(record->mPosition, record->mCompressed, record->mUncompressedSize);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                {
+                    const std::lock_guard lock(mMutex);
+                    record->mResult = std::move(result);
+                    record->mError = error;
+                    record->mDone = true;
+                    record->mCompressed = {};
+                }
+                mHasDone.notify_all();
+            }
+        }
+    };
+
     ReaderContext::ReaderContext()
         : modIndex(0)
         , recHeaderSize(sizeof(RecordHeader))
@@ -518,6 +691,17 @@ namespace ESM4
         return bytesRead == mCtx.recHeaderSize;
     }
 
+    void Reader::prefetchCompressedRecords(std::size_t threads)
+    {
+        if (threads == 0 || mPrefetcher != nullptr)
+            return;
+
+        Files::IStreamPtr stream = Files::openConstrainedFileStream(mCtx.filename);
+        stream->seekg(mStream->tellg());
+
+        mPrefetcher = std::make_unique<RecordPrefetcher>(std::move(stream), mCtx.recHeaderSize, threads);
+    }
+
     void Reader::getRecordData(bool dump)
     {
         std::uint32_t uncompressedSize = 0;
@@ -529,13 +713,25 @@ namespace ESM4
             const std::streamoff position = mStream->tellg();
 
             const std::uint32_t recordSize = mCtx.recordHeader.record.dataSize - sizeof(std::uint32_t);
-            std::vector<char> compressed(recordSize);
-            mStream->read(compressed.data(), recordSize);
+
+            std::unique_ptr<Bsa::MemoryInputStream> memoryStreamPtr;
+            if (mPrefetcher != nullptr)
+                memoryStreamPtr = mPrefetcher->take(position);
+
+            std::vector<char> compressed;
+            if (memoryStreamPtr != nullptr)
+                mStream->seekg(recordSize, std::ios_base::cur);
+            else
+            {
+                compressed.resize(recordSize);
+                mStream->read(compressed.data(), recordSize);
+            }
             mSavedStream = std::move(mStream);
 
             mCtx.recordHeader.record.dataSize = uncompressedSize - sizeof(uncompressedSize);
 
-            auto memoryStreamPtr = decompress(position, compressed, uncompressedSize);
+            if (memoryStreamPtr == nullptr)
+                memoryStreamPtr = decompress(position, compressed, uncompressedSize);
 
             // For debugging only
             // #if 0
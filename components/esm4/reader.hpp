@@ -139,6 +139,8 @@ namespace ESM4
         DLStrings,
     };
 
+    class RecordPrefetcher;
+
     class Reader
     {
         VFS::Manager const* mVFS;
@@ -153,6 +155,8 @@ namespace ESM4
         Files::IStreamPtr mStream;
         Files::IStreamPtr mSavedStream; // mStream is saved here while using deflated memory stream
 
+        std::unique_ptr<RecordPrefetcher> mPrefetcher;
+
         Files::IStreamPtr mStrings;
         Files::IStreamPtr mILStrings;
         Files::IStreamPtr mDLStrings;
@@ -293,6 +297,11 @@ namespace ESM4
 
         inline ESM::FormId currWorld() const { return mCtx.currWorld; }
 
+        // Start to read ahead and decompress compressed records on background threads. Records are still decoded
+        // in the file order by the caller, getRecordData() only takes the decompressed data when it's ready.
+        // Note: must be called before reading the first record after the header
+        void prefetchCompressedRecords(std::size_t threads);
+
         // Get the data part of a record
         // Note: assumes the header was read correctly and nothing else was read
         void getRecordData(bool dump = false);
@@ -18,12 +18,19 @@ namespace Files
 
         pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
         {
+            off_type base = 0;
             if (dir == std::ios_base::cur)
-                gbump(off);
-            else
-                setg(bufferStart, (dir == std::ios_base::beg ? bufferStart : bufferEnd) + off, bufferEnd);
+                base = gptr() - bufferStart;
+            else if (dir == std::ios_base::end)
+                base = bufferEnd - bufferStart;
 
-            return gptr() - bufferStart;
+            // Positions outside of the buffer are invalid, the stream sets failbit and keeps the current position
+            if (off < -base || off > (bufferEnd - bufferStart) - base)
+                return pos_type(off_type(-1));
+
+            setg(bufferStart, bufferStart + base + off, bufferEnd);
+
+            return base + off;
         }
 
         pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
@@ -1,11 +1,35 @@
 #include "openfile.hpp"
 #include "conversion.hpp"
+#include "memorystream.hpp"
+#include "streamwithbuffer.hpp"
 
 #include <cstring>
 #include <fstream>
 
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <components/debug/debuglog.hpp>
+
 namespace Files
 {
+    namespace
+    {
+        struct MappedFile
+        {
+            boost::iostreams::mapped_file_source mFile;
+        };
+
+        // The mapping is a base to be initialized before MemBuf points to its data
+        struct MappedFileBuf final : MappedFile, MemBuf
+        {
+            explicit MappedFileBuf(const boost::iostreams::mapped_file_source& file)
+                : MappedFile{ file }
+                , MemBuf(mFile.data(), mFile.size())
+            {
+            }
+        };
+    }
+
     std::unique_ptr<std::ifstream> openBinaryInputFileStream(const std::filesystem::path& path)
     {
         auto stream = std::make_unique<std::ifstream>(path, std::ios::binary);
@@ -15,4 +39,26 @@ namespace Files
         stream->exceptions(std::ios::badbit);
         return stream;
     }
+
+    std::unique_ptr<std::istream> openMappedInputFileStream(const std::filesystem::path& path)
+    {
+        std::error_code ec;
+        if (std::filesystem::file_size(path, ec) == 0 || ec)
+            return openBinaryInputFileStream(path);
+
+        boost::iostreams::mapped_file_source file;
+        try
+        {
+            file.open(path.native());
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to map '" << path << "' into memory, reading it as a stream: " << e.what();
+            return openBinaryInputFileStream(path);
+        }
+
+        auto stream = std::make_unique<StreamWithBuffer<MappedFileBuf>>(std::make_unique<MappedFileBuf>(file));
+        stream->exceptions(std::ios::badbit);
+        return stream;
+    }
 }
@@ -9,6 +9,10 @@
 namespace Files
 {
     std::unique_ptr<std::ifstream> openBinaryInputFileStream(const std::filesystem::path& path);
+
+    /// Maps the whole file into memory, so reading and seeking the stream is done without system calls. Falls back to
+    /// a regular file stream when the file can't be mapped, for example when it's empty.
+    std::unique_ptr<std::istream> openMappedInputFileStream(const std::filesystem::path& path);
 }
 
 #endif
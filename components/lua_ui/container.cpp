@@ -36,6 +36,9 @@ namespace LuaUi
             outerSize.width = std::max(outerSize.width, coord.left + coord.width);
             outerSize.height = std::max(outerSize.height, coord.top + coord.height);
         }
+        // template children are scaled by the inner size
+        if (innerSize != mInnerSize)
+            markLayoutDirty();
         mInnerSize = innerSize;
         mOuterSize = outerSize;
     }
@@ -147,7 +147,6 @@ namespace LuaUi
             ext->setProperties(layout.get<sol::object>(LayoutKeys::props));
             setEventCallbacks(ext, layout.get<sol::object>(LayoutKeys::events));
             ext->setChildren(updateContent(ext->children(), layout.get<sol::object>(LayoutKeys::content), depth));
-            ext->updateCoord();
         }
 
         std::string setLayer(WidgetExtension* ext, const sol::table& layout)
@@ -253,5 +252,7 @@ namespace LuaUi
             mAttachedTo->setChildren({ mRoot });
             mAttachedTo->updateCoord();
         }
+        else
+            mRoot->updateCoord();
     }
 }
@@ -4,10 +4,16 @@ namespace LuaUi
 {
     void LuaFlex::updateProperties()
     {
+        const bool horizontal = mHorizontal;
+        const bool autoSized = mAutoSized;
+        const Alignment align = mAlign;
+        const Alignment arrange = mArrange;
         mHorizontal = propertyValue("horizontal", false);
         mAutoSized = propertyValue("autoSize", true);
         mAlign = propertyValue("align", Alignment::Start);
         mArrange = propertyValue("arrange", Alignment::Start);
+        if (mHorizontal != horizontal || mAutoSized != autoSized || mAlign != align || mArrange != arrange)
+            markLayoutDirty();
         WidgetExtension::updateProperties();
     }
 
@@ -39,34 +45,51 @@ namespace LuaUi
         }
     }
 
-    void LuaFlex::updateChildren()
+    void LuaFlex::updateChildrenSize()
     {
-        float totalGrow = 0;
         MyGUI::IntSize childrenSize;
         for (auto* w : children())
         {
-            w->clearForced();
-            MyGUI::IntSize size = w->calculateSize();
+            MyGUI::IntSize size = w->calculateUnforcedSize();
             primary(childrenSize) += primary(size);
             secondary(childrenSize) = std::max(secondary(childrenSize), secondary(size));
-            totalGrow += getGrow(w);
         }
-        mChildrenSize = childrenSize;
+        if (childrenSize != mChildrenSize)
+        {
+            mChildrenSize = childrenSize;
+            markLayoutDirty();
+        }
+    }
+
+    void LuaFlex::updateChildren()
+    {
+        updateChildrenSize();
+        WidgetExtension::updateChildren();
+    }
+
+    void LuaFlex::updateChildrenCoord()
+    {
+        for (auto* w : templateChildren())
+            w->updateCoord();
+
+        float totalGrow = 0;
+        for (auto* w : children())
+            totalGrow += getGrow(w);
 
         MyGUI::IntSize flexSize = calculateSize();
         int growSize = 0;
         float growFactor = 0;
         if (totalGrow > 0)
         {
-            growSize = primary(flexSize) - primary(childrenSize);
+            growSize = primary(flexSize) - primary(mChildrenSize);
             growFactor = growSize / totalGrow;
         }
 
         MyGUI::IntPoint childPosition;
-        primary(childPosition) = alignSize(primary(flexSize) - growSize, primary(childrenSize), mAlign);
+        primary(childPosition) = alignSize(primary(flexSize) - growSize, primary(mChildrenSize), mAlign);
         for (auto* w : children())
         {
-            MyGUI::IntSize size = w->calculateSize();
+            MyGUI::IntSize size = w->calculateUnforcedSize();
             primary(size) += static_cast<int>(growFactor * getGrow(w));
             float stretch = std::clamp(w->externalValue("stretch", 0.0f), 0.0f, 1.0f);
             secondary(size) = std::max(secondary(size), static_cast<int>(stretch * secondary(flexSize)));
@@ -76,7 +99,6 @@ namespace LuaUi
             w->updateCoord();
             primary(childPosition) += primary(size);
         }
-        WidgetExtension::updateChildren();
     }
 
     MyGUI::IntSize LuaFlex::childScalingSize()
@@ -101,7 +123,8 @@ namespace LuaUi
 
     void LuaFlex::updateCoord()
     {
-        updateChildren();
+        // sizes of relatively sized children depend on the flex size
+        updateChildrenSize();
         WidgetExtension::updateCoord();
     }
 }
@@ -14,16 +14,19 @@ namespace LuaUi
         MyGUI::IntSize calculateSize() override;
         void updateProperties() override;
         void updateChildren() override;
+        void updateChildrenCoord() override;
         MyGUI::IntSize childScalingSize() override;
 
         void updateCoord() override;
 
     private:
-        bool mHorizontal;
-        bool mAutoSized;
+        void updateChildrenSize();
+
+        bool mHorizontal = false;
+        bool mAutoSized = true;
         MyGUI::IntSize mChildrenSize;
-        Alignment mAlign;
-        Alignment mArrange;
+        Alignment mAlign = Alignment::Start;
+        Alignment mArrange = Alignment::Start;
 
         template <typename T>
         T& primary(MyGUI::types::TPoint<T>& point)
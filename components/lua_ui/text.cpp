@@ -21,13 +21,25 @@ namespace LuaUi
 
     void LuaText::updateProperties()
     {
-        mAutoSized = propertyValue("autoSize", true);
+        const bool autoSized = propertyValue("autoSize", true);
+        if (autoSized != mAutoSized)
+        {
+            mAutoSized = autoSized;
+            markLayoutDirty();
+        }
 
         setCaption(propertyValue("text", std::string()));
-        setFontHeight(propertyValue("textSize", 10));
+
+        const int fontHeight = propertyValue("textSize", 10);
+        const bool multiline = propertyValue("multiline", false);
+        const bool wordWrap = propertyValue("wordWrap", false);
+        if (mAutoSized
+            && (fontHeight != getFontHeight() || multiline != getEditMultiLine() || wordWrap != getEditWordWrap()))
+            markLayoutDirty();
+        setFontHeight(fontHeight);
         setTextColour(propertyValue("textColor", MyGUI::Colour(0, 0, 0, 1)));
-        setEditMultiLine(propertyValue("multiline", false));
-        setEditWordWrap(propertyValue("wordWrap", false));
+        setEditMultiLine(multiline);
+        setEditWordWrap(wordWrap);
 
         Alignment horizontal(propertyValue("textAlignH", Alignment::Start));
         Alignment vertical(propertyValue("textAlignV", Alignment::Start));
@@ -41,9 +53,13 @@ namespace LuaUi
 
     void LuaText::setCaption(const MyGUI::UString& caption)
     {
+        // avoid laying out the text again when a script sets the same caption on every update
+        if (caption == mCurrentCaption)
+            return;
+        mCurrentCaption = caption;
         MyGUI::TextBox::setCaption(caption);
         if (mAutoSized)
-            updateCoord();
+            markLayoutDirty();
     }
 
     MyGUI::IntSize LuaText::calculateSize()
@@ -19,6 +19,7 @@ namespace LuaUi
 
     private:
         bool mAutoSized;
+        MyGUI::UString mCurrentCaption;
 
     protected:
         MyGUI::IntSize calculateSize() override;
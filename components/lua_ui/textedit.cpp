@@ -21,6 +21,10 @@ namespace LuaUi
 
     void LuaTextEdit::updateProperties()
     {
+        const bool autoSize = mAutoSize;
+        const MyGUI::IntSize textSize = mEditBox->getTextSize();
+        const int fontHeight = mEditBox->getFontHeight();
+
         mEditBox->setFontHeight(propertyValue("textSize", 10));
         mEditBox->setTextColour(propertyValue("textColor", MyGUI::Colour(0, 0, 0, 1)));
         mEditBox->setEditWordWrap(propertyValue("wordWrap", false));
@@ -40,6 +44,10 @@ namespace LuaUi
         // change caption last, for multiline and wordwrap to apply
         mEditBox->setCaption(propertyValue("text", std::string()));
 
+        if (mAutoSize != autoSize
+            || (mAutoSize && (mEditBox->getTextSize() != textSize || mEditBox->getFontHeight() != fontHeight)))
+            markLayoutDirty();
+
         WidgetExtension::updateProperties();
     }
 
@@ -18,6 +18,7 @@ namespace LuaUi
         , mExternal(sol::nil)
         , mParent(nullptr)
         , mTemplateChild(false)
+        , mLayoutDirty(true)
     {
     }
 
@@ -185,23 +186,32 @@ namespace LuaUi
 
     void WidgetExtension::setChildren(const std::vector<WidgetExtension*>& children)
     {
+        bool dirty = mChildren != children;
         mChildren.resize(children.size());
         for (size_t i = 0; i < children.size(); ++i)
         {
             mChildren[i] = children[i];
             attach(mChildren[i]);
+            // new children couldn't propagate their dirty flag before being attached
+            dirty = dirty || mChildren[i]->mLayoutDirty;
         }
+        if (dirty)
+            markLayoutDirty();
         updateChildren();
     }
 
     void WidgetExtension::setTemplateChildren(const std::vector<WidgetExtension*>& children)
     {
+        bool dirty = mTemplateChildren != children;
         mTemplateChildren.resize(children.size());
         for (size_t i = 0; i < children.size(); ++i)
         {
             mTemplateChildren[i] = children[i];
             attachTemplate(mTemplateChildren[i]);
+            dirty = dirty || mTemplateChildren[i]->mLayoutDirty;
         }
+        if (dirty)
+            markLayoutDirty();
         updateTemplate();
     }
 
@@ -214,6 +224,14 @@ namespace LuaUi
             mSlot = slot->mSlot;
     }
 
+    void WidgetExtension::setExternal(const sol::object& external)
+    {
+        // external values are used by the parent's layout, changes inside of the same table can't be detected
+        if (external != sol::nil || mExternal != sol::nil)
+            markLayoutDirty();
+        mExternal = external;
+    }
+
     void WidgetExtension::setCallback(const std::string& name, const LuaUtil::Callback& callback)
     {
         mCallbacks[name] = callback;
@@ -261,11 +279,22 @@ namespace LuaUi
 
         if (oldCoord != newCoord)
             mWidget->setCoord(newCoord);
-        updateChildrenCoord();
+        // children are positioned relative to this widget, so moving it doesn't affect them
+        if (mLayoutDirty || oldCoord.size() != newCoord.size())
+        {
+            mLayoutDirty = false;
+            updateChildrenCoord();
+        }
         if (oldCoord != newCoord && mOnCoordChange.has_value())
             mOnCoordChange.value()(this, newCoord);
     }
 
+    void WidgetExtension::markLayoutDirty()
+    {
+        for (WidgetExtension* w = this; w != nullptr; w = w->mParent)
+            w->mLayoutDirty = true;
+    }
+
     void WidgetExtension::setProperties(const sol::object& props)
     {
         mProperties = props;
@@ -274,12 +303,18 @@ namespace LuaUi
 
     void WidgetExtension::updateProperties()
     {
+        const MyGUI::IntCoord absoluteCoord = mAbsoluteCoord;
+        const MyGUI::FloatCoord relativeCoord = mRelativeCoord;
+        const MyGUI::FloatSize anchor = mAnchor;
+
         mPropagateEvents = propertyValue("propagateEvents", true);
         mAbsoluteCoord = propertyValue("position", MyGUI::IntPoint());
         mAbsoluteCoord = propertyValue("size", MyGUI::IntSize());
         mRelativeCoord = propertyValue("relativePosition", MyGUI::FloatPoint());
         mRelativeCoord = propertyValue("relativeSize", MyGUI::FloatSize());
         mAnchor = propertyValue("anchor", MyGUI::FloatSize());
+        if (mAbsoluteCoord != absoluteCoord || mRelativeCoord != relativeCoord || mAnchor != anchor)
+            markLayoutDirty();
         mWidget->setVisible(propertyValue("visible", true));
         mWidget->setPointer(propertyValue("pointer", std::string("arrow")));
         mWidget->setAlpha(propertyValue("alpha", 1.f));
@@ -337,6 +372,17 @@ namespace LuaUi
         return newCoord;
     }
 
+    MyGUI::IntSize WidgetExtension::calculateUnforcedSize()
+    {
+        const bool forcePosition = mForcePosition;
+        const bool forceSize = mForceSize;
+        clearForced();
+        MyGUI::IntSize size = calculateSize();
+        mForcePosition = forcePosition;
+        mForceSize = forceSize;
+        return size;
+    }
+
     MyGUI::IntSize WidgetExtension::childScalingSize()
     {
         return mSlot->widget()->getSize();
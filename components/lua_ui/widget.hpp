@@ -47,7 +47,7 @@ namespace LuaUi
         void setProperties(const sol::object& props);
         void setTemplateProperties(const sol::object& props) { mTemplateProperties = props; }
 
-        void setExternal(const sol::object& external) { mExternal = external; }
+        void setExternal(const sol::object& external);
 
         MyGUI::IntCoord forcedCoord();
         void forceCoord(const MyGUI::IntCoord& offset);
@@ -74,6 +74,8 @@ namespace LuaUi
         virtual MyGUI::IntSize calculateSize();
         virtual MyGUI::IntPoint calculatePosition(const MyGUI::IntSize& size);
         MyGUI::IntCoord calculateCoord();
+        // size the widget would have if its parent didn't force it
+        MyGUI::IntSize calculateUnforcedSize();
 
     protected:
         virtual void initialize();
@@ -100,6 +102,11 @@ namespace LuaUi
         virtual void updateTemplate();
         virtual void updateProperties();
         virtual void updateChildren() {}
+        // called by updateCoord only when the layout of the subtree might have changed
+        virtual void updateChildrenCoord();
+
+        // requests the widget and its ancestors to lay out their children again on the next updateCoord
+        void markLayoutDirty();
 
         lua_State* lua() const { return mLua; }
 
@@ -152,6 +159,7 @@ namespace LuaUi
         sol::object mExternal;
         WidgetExtension* mParent;
         bool mTemplateChild;
+        bool mLayoutDirty;
 
         void attach(WidgetExtension* ext);
         void attachTemplate(WidgetExtension* ext);
@@ -159,8 +167,6 @@ namespace LuaUi
         WidgetExtension* findDeep(std::string_view name);
         void findAll(std::string_view flagName, std::vector<WidgetExtension*>& result);
 
-        void updateChildrenCoord();
-
         void keyPress(MyGUI::Widget*, MyGUI::KeyCode, MyGUI::Char);
         void keyRelease(MyGUI::Widget*, MyGUI::KeyCode);
         void mouseMove(MyGUI::Widget*, int, int);
@@ -10,6 +10,8 @@
 
 #include <osgGA/GUIEventHandler>
 
+#include <cstring>
+
 #include <components/resource/imagemanager.hpp>
 #include <components/sceneutil/nodecallback.hpp>
 #include <components/shader/shadermanager.hpp>
@@ -100,6 +102,8 @@ namespace osgMyGUI
 
             mReadFrom = (mReadFrom + 1) % sNumBuffers;
             const std::vector<Batch>& vec = mBatchVector[mReadFrom];
+            // merged batches share the streaming buffer, so the vertex pointers only need to be set up once for them
+            const osg::VertexBufferObject* lastVbo = nullptr;
             for (std::vector<Batch>::const_iterator it = vec.begin(); it != vec.end(); ++it)
             {
                 const Batch& batch = *it;
@@ -109,6 +113,7 @@ namespace osgMyGUI
                 {
                     state->pushStateSet(batch.mStateSet);
                     state->apply();
+                    lastVbo = nullptr;
                 }
 
                 // A GUI element without an associated texture would be extremely rare.
@@ -120,33 +125,38 @@ namespace osgMyGUI
                 else
                     state->applyTextureAttribute(0, mDummyTexture);
 
-                osg::GLBufferObject* bufferobject = state->isVertexBufferObjectSupported()
-                    ? vbo->getOrCreateGLBufferObject(state->getContextID())
-                    : nullptr;
-                if (bufferobject)
-                {
-                    state->bindVertexBufferObject(bufferobject);
-
-                    glVertexPointer(3, GL_FLOAT, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(0));
-                    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(12));
-                    glTexCoordPointer(2, GL_FLOAT, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(16));
-                }
-                else
+                if (vbo != lastVbo)
                 {
-                    glVertexPointer(3, GL_FLOAT, sizeof(MyGUI::Vertex),
-                        reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()));
-                    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(MyGUI::Vertex),
-                        reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()) + 12);
-                    glTexCoordPointer(2, GL_FLOAT, sizeof(MyGUI::Vertex),
-                        reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()) + 16);
+                    osg::GLBufferObject* bufferobject = state->isVertexBufferObjectSupported()
+                        ? vbo->getOrCreateGLBufferObject(state->getContextID())
+                        : nullptr;
+                    if (bufferobject)
+                    {
+                        state->bindVertexBufferObject(bufferobject);
+
+                        glVertexPointer(3, GL_FLOAT, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(0));
+                        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(12));
+                        glTexCoordPointer(2, GL_FLOAT, sizeof(MyGUI::Vertex), reinterpret_cast<char*>(16));
+                    }
+                    else
+                    {
+                        glVertexPointer(3, GL_FLOAT, sizeof(MyGUI::Vertex),
+                            reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()));
+                        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(MyGUI::Vertex),
+                            reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()) + 12);
+                        glTexCoordPointer(2, GL_FLOAT, sizeof(MyGUI::Vertex),
+                            reinterpret_cast<const char*>(vbo->getArray(0)->getDataPointer()) + 16);
+                    }
+                    lastVbo = vbo;
                 }
 
-                glDrawArrays(GL_TRIANGLES, 0, batch.mVertexCount);
+                glDrawArrays(GL_TRIANGLES, static_cast<GLint>(batch.mFirstVertex), batch.mVertexCount);
 
                 if (batch.mStateSet)
                 {
                     state->popStateSet();
                     state->apply();
+                    lastVbo = nullptr;
                 }
             }
 
@@ -218,11 +228,103 @@ namespace osgMyGUI
             // optional
             osg::ref_ptr<osg::StateSet> mStateSet;
 
+            size_t mFirstVertex = 0;
             size_t mVertexCount;
         };
 
         void addBatch(const Batch& batch) { mBatchVector[mWriteTo].push_back(batch); }
 
+        // Merges runs of consecutive batches sharing a texture and a state set into single draw calls sourcing their
+        // vertices from a streaming buffer. The buffer is only uploaded again when its contents change, so a static
+        // UI costs nothing extra on the GPU side.
+        void mergeBatches()
+        {
+            std::vector<Batch>& batches = mBatchVector[mWriteTo];
+            if (batches.size() < 2)
+                return;
+
+            const auto canMerge = [](const Batch& lhs, const Batch& rhs) {
+                return lhs.mArray != nullptr && rhs.mArray != nullptr && lhs.mTexture == rhs.mTexture
+                    && lhs.mStateSet == rhs.mStateSet;
+            };
+
+            if (mStreamArray[mWriteTo] == nullptr)
+            {
+                mStreamArray[mWriteTo] = new osg::UByteArray;
+                mStreamBuffer[mWriteTo] = new osg::VertexBufferObject;
+                mStreamBuffer[mWriteTo]->setDataVariance(osg::Object::DYNAMIC);
+                mStreamBuffer[mWriteTo]->setUsage(GL_STREAM_DRAW);
+                // NB mStreamBuffer does not own the array
+                mStreamBuffer[mWriteTo]->setArray(0, mStreamArray[mWriteTo].get());
+            }
+
+            osg::UByteArray& stream = *mStreamArray[mWriteTo];
+            std::size_t streamSize = 0;
+            bool changed = false;
+
+            const auto append = [&](const Batch& batch) {
+                const std::size_t size = batch.mVertexCount * sizeof(MyGUI::Vertex);
+                if (size == 0)
+                    return;
+                if (stream.size() < streamSize + size)
+                {
+                    stream.resize(streamSize + size);
+                    changed = true;
+                }
+                const void* data = batch.mArray->getDataPointer();
+                if (changed || std::memcmp(&stream[streamSize], data, size) != 0)
+                {
+                    std::memcpy(&stream[streamSize], data, size);
+                    changed = true;
+                }
+                streamSize += size;
+            };
+
+            std::size_t merged = 0;
+            for (std::size_t begin = 0; begin < batches.size();)
+            {
+                std::size_t end = begin + 1;
+                while (end < batches.size() && canMerge(batches[begin], batches[end]))
+                    ++end;
+
+                if (end - begin == 1)
+                {
+                    if (merged != begin)
+                        batches[merged] = batches[begin];
+                }
+                else
+                {
+                    Batch batch;
+                    batch.mTexture = batches[begin].mTexture;
+                    batch.mStateSet = batches[begin].mStateSet;
+                    batch.mVertexBuffer = mStreamBuffer[mWriteTo];
+                    batch.mArray = mStreamArray[mWriteTo];
+                    batch.mFirstVertex = streamSize / sizeof(MyGUI::Vertex);
+                    for (std::size_t i = begin; i < end; ++i)
+                        append(batches[i]);
+                    batch.mVertexCount = streamSize / sizeof(MyGUI::Vertex) - batch.mFirstVertex;
+                    batches[merged] = std::move(batch);
+                }
+
+                ++merged;
+                begin = end;
+            }
+
+            batches.resize(merged);
+
+            if (stream.size() != streamSize)
+            {
+                stream.resize(streamSize);
+                changed = true;
+            }
+
+            if (changed)
+            {
+                stream.dirty();
+                mStreamBuffer[mWriteTo]->dirty();
+            }
+        }
+
         void clear()
         {
             mWriteTo = (mWriteTo + 1) % sNumBuffers;
@@ -240,6 +342,10 @@ namespace osgMyGUI
         // double buffering approach, to avoid the need for synchronization with the draw thread
         std::vector<Batch> mBatchVector[sNumBuffers];
 
+        // vertices of merged batches, one buffer per batch vector
+        osg::ref_ptr<osg::VertexBufferObject> mStreamBuffer[sNumBuffers];
+        osg::ref_ptr<osg::UByteArray> mStreamArray[sNumBuffers];
+
         int mWriteTo;
         mutable int mReadFrom;
 
@@ -468,7 +574,10 @@ namespace osgMyGUI
         mInjectState = stateSet;
     }
 
-    void RenderManager::end() {}
+    void RenderManager::end()
+    {
+        mDrawable->mergeBatches();
+    }
 
     void RenderManager::update()
     {
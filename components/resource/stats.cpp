@@ -450,6 +450,7 @@ namespace Resource
                 "NavMesh DbJobs Read",
                 "NavMesh DbCache Get",
                 "NavMesh DbCache Hit",
+                "NavMesh DbAhead Hit",
                 "NavMesh CacheSize",
                 "NavMesh UsedTiles",
                 "NavMesh CachedTiles",
@@ -0,0 +1,191 @@
+#include "lightcluster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        // Bounds closer to the camera plane than this are assigned to the first depth slice and cover all the cells
+        // in x and y because projection by depth becomes unstable.
+        constexpr float minDepthLimit = 1.f;
+
+        // Looking up more cells than this is usually slower than testing every light.
+        constexpr int maxCollectedCells = 64;
+
+        constexpr std::size_t cellCount
+            = LightClusterGrid::sCellsX * LightClusterGrid::sCellsY * LightClusterGrid::sCellsZ;
+
+        int toCell(float value, int cells)
+        {
+            return static_cast<int>(std::clamp(value, 0.f, static_cast<float>(cells - 1)));
+        }
+
+        std::size_t getCellIndex(int x, int y, int z)
+        {
+            return (static_cast<std::size_t>(z) * LightClusterGrid::sCellsY + static_cast<std::size_t>(y))
+                * LightClusterGrid::sCellsX
+                + static_cast<std::size_t>(x);
+        }
+
+        // A sphere is bounded by its axis aligned box. The extremes of x/depth and y/depth over the box are
+        // reached at its corners given the box is in front of the camera.
+        void getTanRange(float min, float max, float nearDepth, float farDepth, float& minTan, float& maxTan)
+        {
+            minTan = std::min(min / nearDepth, min / farDepth);
+            maxTan = std::max(max / nearDepth, max / farDepth);
+        }
+
+        template <class Range, class Function>
+        void forEachCell(const Range& range, Function&& function)
+        {
+            for (int z = range.mMinZ; z <= range.mMaxZ; ++z)
+                for (int y = range.mMinY; y <= range.mMaxY; ++y)
+                    for (int x = range.mMinX; x <= range.mMaxX; ++x)
+                        function(getCellIndex(x, y, z));
+        }
+    }
+
+    void LightClusterGrid::clear()
+    {
+        mLightRanges.clear();
+        mOffsets.clear();
+        mIndices.clear();
+    }
+
+    void LightClusterGrid::build(const std::vector<osg::BoundingSphere>& bounds)
+    {
+        clear();
+
+        if (bounds.empty())
+            return;
+
+        float minDepth = std::numeric_limits<float>::max();
+        float maxDepth = minDepthLimit;
+        float minTanX = std::numeric_limits<float>::max();
+        float maxTanX = -std::numeric_limits<float>::max();
+        float minTanY = std::numeric_limits<float>::max();
+        float maxTanY = -std::numeric_limits<float>::max();
+
+        for (const osg::BoundingSphere& bound : bounds)
+        {
+            const float depth = -bound.center().z();
+            const float nearDepth = depth - bound.radius();
+            const float farDepth = depth + bound.radius();
+
+            maxDepth = std::max(maxDepth, farDepth);
+
+            if (nearDepth < minDepthLimit)
+                continue;
+
+            minDepth = std::min(minDepth, nearDepth);
+
+            float minTan = 0;
+            float maxTan = 0;
+            getTanRange(bound.center().x() - bound.radius(), bound.center().x() + bound.radius(), nearDepth,
+                farDepth, minTan, maxTan);
+            minTanX = std::min(minTanX, minTan);
+            maxTanX = std::max(maxTanX, maxTan);
+            getTanRange(bound.center().y() - bound.radius(), bound.center().y() + bound.radius(), nearDepth,
+                farDepth, minTan, maxTan);
+            minTanY = std::min(minTanY, minTan);
+            maxTanY = std::max(maxTanY, maxTan);
+        }
+
+        if (minTanX > maxTanX)
+        {
+            minTanX = minTanY = -1;
+            maxTanX = maxTanY = 1;
+        }
+
+        minDepth = std::clamp(minDepth, minDepthLimit, maxDepth);
+        if (maxDepth <= minDepth * 1.01f)
+            maxDepth = minDepth * 2;
+
+        mMinTanX = minTanX;
+        mMinTanY = minTanY;
+        mScaleX = sCellsX / std::max(maxTanX - minTanX, std::numeric_limits<float>::epsilon());
+        mScaleY = sCellsY / std::max(maxTanY - minTanY, std::numeric_limits<float>::epsilon());
+        mMinDepth = minDepth;
+        mDepthScale = sCellsZ / std::log(maxDepth / minDepth);
+
+        mLightRanges.reserve(bounds.size());
+        mOffsets.assign(cellCount + 1, 0);
+
+        for (const osg::BoundingSphere& bound : bounds)
+        {
+            const CellRange& range = mLightRanges.emplace_back(getCellRange(bound));
+            forEachCell(range, [&](std::size_t cell) { ++mOffsets[cell + 1]; });
+        }
+
+        std::partial_sum(mOffsets.begin(), mOffsets.end(), mOffsets.begin());
+
+        mIndices.resize(mOffsets.back());
+
+        std::vector<std::uint32_t> positions(mOffsets.begin(), mOffsets.end() - 1);
+        for (std::size_t i = 0; i < mLightRanges.size(); ++i)
+            forEachCell(mLightRanges[i],
+                [&](std::size_t cell) { mIndices[positions[cell]++] = static_cast<std::uint32_t>(i); });
+    }
+
+    bool LightClusterGrid::collect(const osg::BoundingSphere& bound, std::vector<std::uint32_t>& indices) const
+    {
+        if (empty() || !bound.valid())
+            return false;
+
+        const CellRange range = getCellRange(bound);
+
+        const int cells = (range.mMaxX - range.mMinX + 1) * (range.mMaxY - range.mMinY + 1)
+            * (range.mMaxZ - range.mMinZ + 1);
+        if (cells > maxCollectedCells)
+            return false;
+
+        forEachCell(range, [&](std::size_t cell) {
+            indices.insert(indices.end(), mIndices.begin() + mOffsets[cell], mIndices.begin() + mOffsets[cell + 1]);
+        });
+
+        return true;
+    }
+
+    LightClusterGrid::CellRange LightClusterGrid::getCellRange(const osg::BoundingSphere& bound) const
+    {
+        const float depth = -bound.center().z();
+        const float nearDepth = depth - bound.radius();
+        const float farDepth = depth + bound.radius();
+
+        const auto getDepthCell = [&](float value) {
+            if (value <= mMinDepth)
+                return 0;
+            return toCell(std::log(value / mMinDepth) * mDepthScale, sCellsZ);
+        };
+
+        CellRange result;
+        result.mMinZ = getDepthCell(nearDepth);
+        result.mMaxZ = getDepthCell(farDepth);
+
+        if (nearDepth < minDepthLimit)
+        {
+            result.mMinX = 0;
+            result.mMaxX = sCellsX - 1;
+            result.mMinY = 0;
+            result.mMaxY = sCellsY - 1;
+            return result;
+        }
+
+        float minTan = 0;
+        float maxTan = 0;
+        getTanRange(bound.center().x() - bound.radius(), bound.center().x() + bound.radius(), nearDepth, farDepth,
+            minTan, maxTan);
+        result.mMinX = toCell((minTan - mMinTanX) * mScaleX, sCellsX);
+        result.mMaxX = toCell((maxTan - mMinTanX) * mScaleX, sCellsX);
+        getTanRange(bound.center().y() - bound.radius(), bound.center().y() + bound.radius(), nearDepth, farDepth,
+            minTan, maxTan);
+        result.mMinY = toCell((minTan - mMinTanY) * mScaleY, sCellsY);
+        result.mMaxY = toCell((maxTan - mMinTanY) * mScaleY, sCellsY);
+
+        return result;
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_LIGHTCLUSTER_H
+#define OPENMW_COMPONENTS_SCENEUTIL_LIGHTCLUSTER_H
+
+#include <osg/BoundingSphere>
+
+#include <cstdint>
+#include <vector>
+
+namespace SceneUtil
+{
+    /// Grid of view frustum aligned cells (froxels) holding indices of the view space light bounds overlapping each
+    /// cell. Built once per camera per frame, it allows to find lights potentially affecting an object by looking up
+    /// the cells covered by the object bound instead of testing every light.
+    /// @note Cells are sliced uniformly by x/depth and y/depth and exponentially by depth over the extents of the
+    /// lights. Bounds outside of the extents are assigned to the border cells so lookups are always conservative.
+    class LightClusterGrid
+    {
+    public:
+        static constexpr int sCellsX = 16;
+        static constexpr int sCellsY = 8;
+        static constexpr int sCellsZ = 16;
+
+        void clear();
+
+        /// @param bounds light bounds in view space, collected indices refer to this vector.
+        void build(const std::vector<osg::BoundingSphere>& bounds);
+
+        bool empty() const { return mOffsets.empty(); }
+
+        /// Appends indices of the lights assigned to the cells covered by a view space bound. Indices may be
+        /// duplicated and are not ordered. Returns false without appending anything when the grid is empty, the bound
+        /// is invalid or covers too many cells for the lookup to be cheaper than testing every light.
+        bool collect(const osg::BoundingSphere& bound, std::vector<std::uint32_t>& indices) const;
+
+    private:
+        struct CellRange
+        {
+            int mMinX;
+            int mMaxX;
+            int mMinY;
+            int mMaxY;
+            int mMinZ;
+            int mMaxZ;
+        };
+
+        CellRange getCellRange(const osg::BoundingSphere& bound) const;
+
+        float mMinTanX = 0;
+        float mMinTanY = 0;
+        float mScaleX = 0;
+        float mScaleY = 0;
+        float mMinDepth = 0;
+        float mDepthScale = 0;
+        std::vector<CellRange> mLightRanges;
+        std::vector<std::uint32_t> mOffsets;
+        std::vector<std::uint32_t> mIndices;
+    };
+}
+
+#endif
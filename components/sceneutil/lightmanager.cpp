@@ -26,6 +26,8 @@ namespace
     constexpr int maxLightsLowerLimit = 2;
     constexpr int maxLightsUpperLimit = 64;
     constexpr int ffpMaxLights = 8;
+    // Below this number of lights in view testing every light against an object is cheaper than a cluster lookup
+    constexpr std::size_t minClusteredLights = 16;
 
     bool sortLights(const SceneUtil::LightManager::LightSourceViewBound* left,
         const SceneUtil::LightManager::LightSourceViewBound* right)
@@ -1140,7 +1142,7 @@ namespace SceneUtil
         return stateset;
     }
 
-    const std::vector<LightManager::LightSourceViewBound>& LightManager::getLightsInViewSpace(
+    const LightManager::ViewSpaceLights& LightManager::getLightsInViewSpace(
         osgUtil::CullVisitor* cv, const osg::RefMatrix* viewMatrix, size_t frameNum)
     {
         osg::Camera* camera = cv->getCurrentCamera();
@@ -1150,7 +1152,8 @@ namespace SceneUtil
 
         if (it == mLightsInViewSpace.end())
         {
-            it = mLightsInViewSpace.insert(std::make_pair(camPtr, LightSourceViewBoundCollection())).first;
+            it = mLightsInViewSpace.insert(std::make_pair(camPtr, ViewSpaceLights())).first;
+            auto& lights = it->second.mLights;
 
             for (const auto& transform : mLights)
             {
@@ -1186,7 +1189,7 @@ namespace SceneUtil
                 LightSourceViewBound l;
                 l.mLightSource = transform.mLightSource;
                 l.mViewBound = viewBound;
-                it->second.push_back(l);
+                lights.push_back(l);
             }
 
             const bool fillPPLights = mPPLightBuffer && it->first->getName() == Constants::SceneCamera;
@@ -1198,11 +1201,11 @@ namespace SceneUtil
                         < right.mViewBound.center().length2() - right.mViewBound.radius2();
                 };
 
-                std::sort(it->second.begin(), it->second.end(), sorter);
+                std::sort(lights.begin(), lights.end(), sorter);
 
                 if (fillPPLights)
                 {
-                    for (const auto& bound : it->second)
+                    for (const auto& bound : lights)
                     {
                         if (bound.mLightSource->getEmpty())
                             continue;
@@ -1212,8 +1215,16 @@ namespace SceneUtil
                     }
                 }
 
-                if (it->second.size() > static_cast<size_t>(getMaxLightsInScene() - 1))
-                    it->second.resize(getMaxLightsInScene() - 1);
+                if (lights.size() > static_cast<size_t>(getMaxLightsInScene() - 1))
+                    lights.resize(getMaxLightsInScene() - 1);
+            }
+
+            if (lights.size() >= minClusteredLights)
+            {
+                mClusterBounds.clear();
+                for (const auto& bound : lights)
+                    mClusterBounds.push_back(bound.mViewBound);
+                it->second.mClusters.build(mClusterBounds);
             }
         }
 
@@ -1290,15 +1301,13 @@ namespace SceneUtil
         if (!(cv->getTraversalMask() & mLightManager->getLightingMask()))
             return false;
 
-        // Possible optimizations:
-        // - organize lights in a quad tree
-
         mLastFrameNumber = cv->getTraversalNumber();
 
         // Don't use Camera::getViewMatrix, that one might be relative to another camera!
         const osg::RefMatrix* viewMatrix = cv->getCurrentRenderStage()->getInitialViewMatrix();
-        const std::vector<LightManager::LightSourceViewBound>& lights
+        const LightManager::ViewSpaceLights& viewSpaceLights
             = mLightManager->getLightsInViewSpace(cv, viewMatrix, mLastFrameNumber);
+        const std::vector<LightManager::LightSourceViewBound>& lights = viewSpaceLights.mLights;
 
         // get the node bounds in view space
         // NB do not node->getBound() * modelView, that would apply the node's transformation twice
@@ -1314,16 +1323,29 @@ namespace SceneUtil
         osg::Matrixf mat = *cv->getModelViewMatrix();
         transformBoundingSphere(mat, nodeBound);
 
-        mLightList.clear();
-        for (size_t i = 0; i < lights.size(); ++i)
-        {
-            const LightManager::LightSourceViewBound& l = lights[i];
-
+        const auto addLight = [&](const LightManager::LightSourceViewBound& l) {
             if (mIgnoredLightSources.count(l.mLightSource))
-                continue;
+                return;
 
             if (l.mViewBound.intersects(nodeBound))
                 mLightList.push_back(&l);
+        };
+
+        mLightList.clear();
+        mClusterLightIndices.clear();
+        if (viewSpaceLights.mClusters.collect(nodeBound, mClusterLightIndices))
+        {
+            // keep the order of the full scan so the same light lists map to the same cached statesets
+            std::sort(mClusterLightIndices.begin(), mClusterLightIndices.end());
+            mClusterLightIndices.erase(
+                std::unique(mClusterLightIndices.begin(), mClusterLightIndices.end()), mClusterLightIndices.end());
+            for (const std::uint32_t index : mClusterLightIndices)
+                addLight(lights[index]);
+        }
+        else
+        {
+            for (const LightManager::LightSourceViewBound& l : lights)
+                addLight(l);
         }
 
         if (!mLightList.empty())
@@ -2,6 +2,7 @@
 #define OPENMW_COMPONENTS_SCENEUTIL_LIGHTMANAGER_H
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -11,6 +12,7 @@
 #include <osg/NodeVisitor>
 #include <osg/observer_ptr>
 
+#include <components/sceneutil/lightcluster.hpp>
 #include <components/sceneutil/nodecallback.hpp>
 #include <components/settings/settings.hpp>
 
@@ -207,6 +209,13 @@ namespace SceneUtil
             osg::BoundingSphere mViewBound;
         };
 
+        struct ViewSpaceLights
+        {
+            std::vector<LightSourceViewBound> mLights;
+            // Indices of mLights by view frustum cell, empty when there are too few lights for lookups to pay off
+            LightClusterGrid mClusters;
+        };
+
         using LightList = std::vector<const LightSourceViewBound*>;
         using SupportedMethods = std::array<bool, 3>;
 
@@ -234,7 +243,7 @@ namespace SceneUtil
         /// Internal use only, called automatically by the LightSource's UpdateCallback
         void addLight(LightSource* lightSource, const osg::Matrixf& worldMat, size_t frameNum);
 
-        const std::vector<LightSourceViewBound>& getLightsInViewSpace(
+        const ViewSpaceLights& getLightsInViewSpace(
             osgUtil::CullVisitor* cv, const osg::RefMatrix* viewMatrix, size_t frameNum);
 
         osg::ref_ptr<osg::StateSet> getLightListStateSet(
@@ -291,8 +300,8 @@ namespace SceneUtil
 
         std::vector<LightSourceTransform> mLights;
 
-        using LightSourceViewBoundCollection = std::vector<LightSourceViewBound>;
-        std::map<osg::observer_ptr<osg::Camera>, LightSourceViewBoundCollection> mLightsInViewSpace;
+        std::map<osg::observer_ptr<osg::Camera>, ViewSpaceLights> mLightsInViewSpace;
+        std::vector<osg::BoundingSphere> mClusterBounds;
 
         using LightIdList = std::vector<int>;
         struct HashLightIdList
@@ -371,6 +380,7 @@ namespace SceneUtil
         LightManager* mLightManager;
         size_t mLastFrameNumber;
         LightManager::LightList mLightList;
+        std::vector<std::uint32_t> mClusterLightIndices;
         std::set<SceneUtil::LightSource*> mIgnoredLightSources;
     };
 
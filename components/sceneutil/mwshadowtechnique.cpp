@@ -345,8 +345,89 @@ void VDSMCameraCullCallback::operator()(osg::Node* node, osg::NodeVisitor* nv)
     _projectionMatrix = cv->getProjectionMatrix();
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ReceiverBounds
+//
+// Collects the light view space bounds of everything the main view has culled. For a directional light a caster
+// outside of their x/y extents can't cast a shadow onto anything visible.
+struct ReceiverBounds
+{
+    void set(const osg::Matrixd& inverseViewMatrix, const osg::Matrixd& lightViewMatrix)
+    {
+        viewToLightView = inverseViewMatrix * lightViewMatrix;
+        previousModelView = nullptr;
+    }
+
+    void operator() (const osgUtil::RenderLeaf* renderLeaf)
+    {
+        if (!renderLeaf->_drawable)
+            return;
+
+        const osg::BoundingBox& bb = renderLeaf->_drawable->getBoundingBox();
+        if (!bb.valid())
+            return;
+
+        if (renderLeaf->_modelview.get() != previousModelView || previousModelView == nullptr)
+        {
+            previousModelView = renderLeaf->_modelview.get();
+            if (previousModelView)
+                modelViewToLightView.mult(*previousModelView, viewToLightView);
+            else
+                modelViewToLightView = viewToLightView;
+        }
+
+        for (unsigned int i = 0; i < 8; ++i)
+            bounds.expandBy(osg::Vec3d(bb.corner(i)) * modelViewToLightView);
+    }
+
+    osg::Matrixd viewToLightView;
+    osg::Matrixd modelViewToLightView;
+    const osg::RefMatrix* previousModelView = nullptr;
+    osg::BoundingBoxd bounds;
+};
+
+// Relative cameras are culled with their view matrix combined with the view of the enclosing render stage
+osg::Matrixd getNestedViewMatrix(const osg::Camera* camera, const osg::Matrixd& parentViewMatrix)
+{
+    if (camera == nullptr)
+        return parentViewMatrix;
+    if (camera->getReferenceFrame() != osg::Transform::RELATIVE_RF)
+        return camera->getViewMatrix();
+    if (camera->getTransformOrder() == osg::Camera::POST_MULTIPLY)
+        return parentViewMatrix * camera->getViewMatrix();
+    return camera->getViewMatrix() * parentViewMatrix;
+}
+
+// Nested render stages, i.e. RTT cameras culled within the main view, may render receivers using the same shadow maps
+void collectReceiverBounds(osgUtil::RenderStage& renderStage, const osg::Matrixd& viewMatrix,
+    const osg::Matrixd& lightViewMatrix, RenderLeafTraverser<ReceiverBounds>& traverser)
+{
+    const auto collectNested = [&] (osgUtil::RenderStage::RenderStageList& stages)
+    {
+        for (const auto& [order, stage] : stages)
+            collectReceiverBounds(*stage, getNestedViewMatrix(stage->getCamera(), viewMatrix), lightViewMatrix,
+                traverser);
+    };
+
+    collectNested(renderStage.getPreRenderList());
+
+    traverser.set(osg::Matrixd::inverse(viewMatrix), lightViewMatrix);
+    traverser.traverse(&renderStage);
+
+    collectNested(renderStage.getPostRenderList());
+}
+
 } // namespace
 
+osg::BoundingBoxd SceneUtil::computeReceiverBounds(osgUtil::RenderStage& renderStage, const osg::Matrixd& viewMatrix,
+    const osg::Matrixd& lightViewMatrix)
+{
+    RenderLeafTraverser<ReceiverBounds> receivers;
+    collectReceiverBounds(renderStage, viewMatrix, lightViewMatrix, receivers);
+    return receivers.bounds;
+}
+
 MWShadowTechnique::ComputeLightSpaceBounds::ComputeLightSpaceBounds() :
     osg::NodeVisitor(osg::NodeVisitor::TRAVERSE_ACTIVE_CHILDREN)
 {
@@ -915,6 +996,11 @@ void SceneUtil::MWShadowTechnique::disableFrontFaceCulling()
     }
 }
 
+void SceneUtil::MWShadowTechnique::setCullCastersOutsideReceivers(bool value)
+{
+    _cullCastersOutsideReceivers = value;
+}
+
 void SceneUtil::MWShadowTechnique::setupCastingShader(Shader::ShaderManager & shaderManager)
 {
     // This can't be part of the constructor as OSG mandates that there be a trivial constructor available
@@ -1222,6 +1308,14 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
             continue;
         }
 
+        // compute the light space footprint of everything the main view has culled to skip casters outside of it,
+        // custom frustums are shared with other views that have culled different receivers
+        osg::BoundingBoxd receiverBounds;
+        if (_cullCastersOutsideReceivers && pl.directionalLight && !_customFrustumCallback)
+        {
+            receiverBounds = computeReceiverBounds(*cv.getCurrentRenderStage(), *cv.getModelViewMatrix(), viewMatrix);
+        }
+
         // if we are using multiple shadow maps and CastShadowTraversalMask is being used
         // traverse the scene to compute the extents of the objects
         if (/*numShadowMapsPerLight>1 &&*/ (_shadowedScene->getCastsShadowTraversalMask() & _worldMask) == 0)
@@ -1369,6 +1463,16 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
             osg::Polytope local_polytope(polytope);
             local_polytope.transformProvidingInverse(invertModelView);
 
+            if (receiverBounds.valid())
+            {
+                // light space x/y extents of the receivers in light eye coords, shadows are cast along z
+                local_polytope.getPlaneList().emplace_back(1.0, 0.0, 0.0, -receiverBounds.xMin());
+                local_polytope.getPlaneList().emplace_back(-1.0, 0.0, 0.0, receiverBounds.xMax());
+                local_polytope.getPlaneList().emplace_back(0.0, 1.0, 0.0, -receiverBounds.yMin());
+                local_polytope.getPlaneList().emplace_back(0.0, -1.0, 0.0, receiverBounds.yMax());
+                local_polytope.setupMask();
+            }
+
             double cascaseNear = reducedNear;
             double cascadeFar = reducedFar;
             if (numShadowMapsPerLight>1)
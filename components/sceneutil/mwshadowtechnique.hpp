@@ -88,6 +88,9 @@ namespace SceneUtil {
 
         virtual void setupCastingShader(Shader::ShaderManager &shaderManager);
 
+        /** Skip shadow casters which can't cast onto anything the main view has culled. Only applies to directional lights. */
+        virtual void setCullCastersOutsideReceivers(bool value);
+
         class ComputeLightSpaceBounds : public osg::NodeVisitor, public osg::CullStack
         {
         public:
@@ -297,6 +300,8 @@ namespace SceneUtil {
 
         float                                   _shadowFadeStart = 0.0;
 
+        bool                                    _cullCastersOutsideReceivers = false;
+
         unsigned int                            _worldMask = ~0u;
 
         class DebugHUD final : public osg::Referenced
@@ -329,6 +334,10 @@ namespace SceneUtil {
         osg::ref_ptr<osg::StateSet> _shadowsBinStateSet;
     };
 
+    /** Compute the light view space bounds of the drawables rendered by the render stage and the render stages nested in it.
+      * viewMatrix is the view matrix the render stage is culled with, nested relative cameras are combined with it.*/
+    osg::BoundingBoxd computeReceiverBounds(osgUtil::RenderStage& renderStage, const osg::Matrixd& viewMatrix, const osg::Matrixd& lightViewMatrix);
+
 }
 
 #endif
@@ -42,6 +42,7 @@ namespace SceneUtil
     RigGeometry::RigGeometry()
         : mSkeleton(nullptr)
         , mLastFrameNumber(0)
+        , mLastCullFrameNumber(0)
         , mBoundsFirstFrame(true)
     {
         setNumChildrenRequiringUpdateTraversal(1);
@@ -55,6 +56,7 @@ namespace SceneUtil
         , mBone2VertexVector(copy.mBone2VertexVector)
         , mBoneSphereVector(copy.mBoneSphereVector)
         , mLastFrameNumber(0)
+        , mLastCullFrameNumber(0)
         , mBoundsFirstFrame(true)
     {
         setSourceGeometry(copy.mSourceGeometry);
@@ -204,7 +206,13 @@ namespace SceneUtil
         }
 
         unsigned int traversalNumber = nv->getTraversalNumber();
-        if (mLastFrameNumber == traversalNumber || (mLastFrameNumber != 0 && !mSkeleton->getActive()))
+        // Neither buffer is drawn when the geometry was not culled in the previous frame, so it can be updated at once
+        const bool culledRecently = mLastCullFrameNumber + 1 >= traversalNumber;
+        mLastCullFrameNumber = traversalNumber;
+        if (mLastFrameNumber == traversalNumber
+            || (mLastFrameNumber != 0
+                && (!mSkeleton->getActive()
+                    || (culledRecently && mSkeleton->isUpdateSkipped(traversalNumber, mLastFrameNumber)))))
         {
             osg::Geometry& geom = *getGeometry(mLastFrameNumber);
             nv->pushOntoNodePath(&geom);
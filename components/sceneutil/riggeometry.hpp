@@ -112,6 +112,7 @@ namespace SceneUtil
         std::vector<Bone*> mBoneNodesVector;
 
         unsigned int mLastFrameNumber;
+        unsigned int mLastCullFrameNumber;
         bool mBoundsFirstFrame;
 
         bool initFromParentSkeleton(osg::NodeVisitor* nv);
@@ -73,6 +73,9 @@ namespace SceneUtil
         else
             mShadowSettings->setMultipleShadowMapHint(osgShadow::ShadowSettings::PARALLEL_SPLIT);
 
+        mShadowTechnique->setCullCastersOutsideReceivers(
+            Settings::Manager::getBool("cull casters outside receivers", "Shadows"));
+
         if (Settings::Manager::getBool("enable debug hud", "Shadows"))
             mShadowTechnique->enableDebugHUD();
         else
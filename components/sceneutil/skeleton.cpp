@@ -6,9 +6,14 @@
 #include <components/misc/strings/lower.hpp>
 
 #include <algorithm>
+#include <atomic>
 
 namespace SceneUtil
 {
+    namespace
+    {
+        std::atomic<unsigned int> sNextUpdatePhase{ 0 };
+    }
 
     class InitBoneCacheVisitor : public osg::NodeVisitor
     {
@@ -39,6 +44,7 @@ namespace SceneUtil
         , mActive(Active)
         , mLastFrameNumber(0)
         , mLastCullFrameNumber(0)
+        , mUpdatePhase(sNextUpdatePhase++)
     {
     }
 
@@ -49,6 +55,8 @@ namespace SceneUtil
         , mActive(copy.mActive)
         , mLastFrameNumber(0)
         , mLastCullFrameNumber(0)
+        , mUpdateInterval(copy.mUpdateInterval)
+        , mUpdatePhase(sNextUpdatePhase++)
     {
     }
 
@@ -121,6 +129,22 @@ namespace SceneUtil
         return mActive != Inactive;
     }
 
+    void Skeleton::setUpdateInterval(unsigned int interval)
+    {
+        mUpdateInterval = std::max(interval, 1u);
+    }
+
+    bool Skeleton::isUpdateSkipped(unsigned int traversalNumber, unsigned int lastFrameNumber) const
+    {
+        if (lastFrameNumber == 0)
+            return false;
+        const unsigned int elapsed = traversalNumber - lastFrameNumber;
+        if (elapsed % 2 == 0 || elapsed < mUpdateInterval)
+            return true;
+        // Prefer the frames of the skeleton's phase, unless the update is already late
+        return elapsed < 2 * mUpdateInterval && (traversalNumber + mUpdatePhase) % mUpdateInterval != 0;
+    }
+
     void Skeleton::markDirty()
     {
         mLastFrameNumber = 0;
@@ -136,6 +160,12 @@ namespace SceneUtil
                 return;
             if (mActive == SemiActive && mLastFrameNumber != 0 && mLastCullFrameNumber + 3 <= nv.getTraversalNumber())
                 return;
+            if (mUpdateInterval > 1 && mRootBone != nullptr
+                && isUpdateSkipped(nv.getTraversalNumber(), mLastFrameNumber))
+            {
+                traverseSkippingBones(*this, *mRootBone, nv);
+                return;
+            }
         }
         else if (nv.getVisitorType() == osg::NodeVisitor::CULL_VISITOR)
             mLastCullFrameNumber = nv.getTraversalNumber();
@@ -143,6 +173,27 @@ namespace SceneUtil
         osg::Group::traverse(nv);
     }
 
+    void Skeleton::traverseSkippingBones(osg::Group& group, const Bone& bone, osg::NodeVisitor& nv)
+    {
+        for (unsigned int i = 0; i < group.getNumChildren(); ++i)
+        {
+            osg::Node* const child = group.getChild(i);
+            const auto it = std::find_if(bone.mChildren.begin(), bone.mChildren.end(),
+                [&](const auto& v) { return v->mNode == child; });
+            if (it == bone.mChildren.end())
+            {
+                child->accept(nv);
+                continue;
+            }
+            if (!nv.validNodeMask(*child))
+                continue;
+            // Don't run the callbacks of the bone, but still update everything attached to it
+            nv.pushOntoNodePath(child);
+            traverseSkippingBones(*(*it)->mNode, **it, nv);
+            nv.popFromNodePath();
+        }
+    }
+
     void Skeleton::childInserted(unsigned int)
     {
         markDirty();
@@ -56,6 +56,17 @@ namespace SceneUtil
 
         bool getActive() const;
 
+        /// Animate the bones only every \a interval frames, skinned geometry keeps the last result in between. Used to
+        /// reduce the cost of distant actors.
+        /// @note Only the update callbacks of the bones used for skinning are skipped, other nodes under the skeleton
+        /// such as attached lights and effects are updated every frame.
+        void setUpdateInterval(unsigned int interval);
+
+        /// @return true when the skinning last updated in \a lastFrameNumber has to be kept in this frame.
+        /// @note At least the update interval passes between the updates, and always an odd number of frames, so the
+        /// double buffered RigGeometry never writes the buffer that is still drawn from the previous frame.
+        bool isUpdateSkipped(unsigned int traversalNumber, unsigned int lastFrameNumber) const;
+
         void traverse(osg::NodeVisitor& nv) override;
 
         void markDirty();
@@ -64,6 +75,8 @@ namespace SceneUtil
         void childRemoved(unsigned int, unsigned int) override;
 
     private:
+        void traverseSkippingBones(osg::Group& group, const Bone& bone, osg::NodeVisitor& nv);
+
         // The root bone is not a "real" bone, it has no corresponding node in the scene graph.
         // As far as the scene graph goes we support multiple root bones.
         std::unique_ptr<Bone> mRootBone;
@@ -78,6 +91,10 @@ namespace SceneUtil
 
         unsigned int mLastFrameNumber;
         unsigned int mLastCullFrameNumber;
+
+        unsigned int mUpdateInterval = 1;
+        // Spreads the updates of the skeletons with the same interval over the frames
+        unsigned int mUpdatePhase;
     };
 
 }
@@ -1,11 +1,55 @@
 #include "workqueue.hpp"
 
 #include <components/debug/debuglog.hpp>
+#include <components/debug/tracing.hpp>
 
+#include <exception>
 #include <numeric>
 
 namespace SceneUtil
 {
+    namespace
+    {
+        class ParallelForItem final : public WorkItem
+        {
+        public:
+            explicit ParallelForItem(const std::function<void(std::size_t)>& function, std::size_t index)
+                : mFunction(function)
+                , mIndex(index)
+            {
+            }
+
+            // Only the thread taking the item may run it, the function is not accessed otherwise as it may not exist
+            // anymore when a worker gets the item already run by the calling thread.
+            bool take() { return !mTaken.exchange(true); }
+
+            void run()
+            {
+                try
+                {
+                    mFunction(mIndex);
+                }
+                catch (...)
+                {
+                    mError = std::current_exception();
+                }
+            }
+
+            void doWork() override
+            {
+                if (take())
+                    run();
+            }
+
+            std::exception_ptr getError() const { return mError; }
+
+        private:
+            const std::function<void(std::size_t)>& mFunction;
+            const std::size_t mIndex;
+            std::atomic_bool mTaken{ false };
+            std::exception_ptr mError;
+        };
+    }
 
     void WorkItem::waitTillDone()
     {
@@ -125,13 +169,17 @@ namespace SceneUtil
 
     void WorkThread::run()
     {
+        Debug::setTraceThreadName("WorkQueue");
         while (true)
         {
             osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem();
             if (!item)
                 return;
             mActive = true;
-            item->doWork();
+            {
+                const Debug::ScopedTrace trace("workitem");
+                item->doWork();
+            }
             item->signalDone();
             mActive = false;
         }
@@ -142,4 +190,34 @@ namespace SceneUtil
         return mActive;
     }
 
+    void parallelFor(WorkQueue* workQueue, std::size_t count, const std::function<void(std::size_t)>& function)
+    {
+        if (count == 0)
+            return;
+
+        std::vector<osg::ref_ptr<ParallelForItem>> items;
+        items.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            items.push_back(new ParallelForItem(function, i));
+
+        // The first item is always run by the calling thread
+        if (workQueue != nullptr)
+            for (std::size_t i = 1; i < count; ++i)
+                workQueue->addWorkItem(items[i], true);
+
+        std::exception_ptr error;
+        for (const osg::ref_ptr<ParallelForItem>& item : items)
+        {
+            if (item->take())
+                item->run();
+            else
+                item->waitTillDone();
+            if (error == nullptr)
+                error = item->getError();
+        }
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+    }
+
 }
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -66,6 +67,8 @@ namespace SceneUtil
 
         unsigned int getNumActiveThreads() const;
 
+        std::size_t getNumThreads() const { return mThreads.size(); }
+
     private:
         bool mIsReleased;
         std::deque<osg::ref_ptr<WorkItem>> mQueue;
@@ -94,6 +97,12 @@ namespace SceneUtil
         void run();
     };
 
+    /// Calls \a function for each index in [0, count) on the threads of \a workQueue and the calling thread, returns
+    /// when all the calls are finished. The calling thread runs the indices not taken by the workers yet instead of
+    /// waiting for them, so it can be used from a work item too. Rethrows the first exception thrown by \a function.
+    /// @note Without a work queue all the indices are processed by the calling thread.
+    void parallelFor(WorkQueue* workQueue, std::size_t count, const std::function<void(std::size_t)>& function);
+
 }
 
 #endif
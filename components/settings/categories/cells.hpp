@@ -33,6 +33,9 @@ namespace Settings
         SettingValue<float> mCacheExpiryDelay{ mIndex, "Cells", "cache expiry delay", makeMaxSanitizerFloat(0) };
         SettingValue<float> mTargetFramerate{ mIndex, "Cells", "target framerate", makeMaxStrictSanitizerFloat(0) };
         SettingValue<int> mPointersCacheSize{ mIndex, "Cells", "pointers cache size", makeClampSanitizerInt(40, 1000) };
+        SettingValue<float> mStreamingBudget{ mIndex, "Cells", "streaming budget", makeMaxSanitizerFloat(0) };
+        SettingValue<int> mReferenceLoadingThreads{ mIndex, "Cells", "reference loading threads",
+            makeMaxSanitizerInt(1) };
     };
 }
 
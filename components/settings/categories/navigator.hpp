@@ -63,6 +63,12 @@ namespace Settings
         SettingValue<bool> mEnableNavMeshDiskCache{ mIndex, "Navigator", "enable nav mesh disk cache" };
         SettingValue<bool> mWriteToNavmeshdb{ mIndex, "Navigator", "write to navmeshdb" };
         SettingValue<std::uint64_t> mMaxNavmeshdbFileSize{ mIndex, "Navigator", "max navmeshdb file size" };
+        SettingValue<std::size_t> mMaxNavmeshdbWriteBatchSize{ mIndex, "Navigator", "max navmeshdb write batch size",
+            makeMaxSanitizerSize(1) };
+        SettingValue<int> mMaxNavmeshdbWriteBatchDelayMs{ mIndex, "Navigator", "max navmeshdb write batch delay ms",
+            makeMaxSanitizerInt(0) };
+        SettingValue<int> mNavmeshdbReadAheadDistance{ mIndex, "Navigator", "navmeshdb read ahead distance",
+            makeMaxSanitizerInt(0) };
     };
 }
 
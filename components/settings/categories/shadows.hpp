@@ -43,6 +43,7 @@ namespace Settings
         SettingValue<bool> mTerrainShadows{ mIndex, "Shadows", "terrain shadows" };
         SettingValue<bool> mObjectShadows{ mIndex, "Shadows", "object shadows" };
         SettingValue<bool> mEnableIndoorShadows{ mIndex, "Shadows", "enable indoor shadows" };
+        SettingValue<bool> mCullCastersOutsideReceivers{ mIndex, "Shadows", "cull casters outside receivers" };
     };
 }
 
@@ -26,6 +26,8 @@ namespace Settings
         SettingValue<float> mVoiceVolume{ mIndex, "Sound", "voice volume", makeClampSanitizerFloat(0, 1) };
         SettingValue<int> mBufferCacheMin{ mIndex, "Sound", "buffer cache min", makeMaxSanitizerInt(1) };
         SettingValue<int> mBufferCacheMax{ mIndex, "Sound", "buffer cache max", makeMaxSanitizerInt(1) };
+        SettingValue<int> mDecodedCacheMax{ mIndex, "Sound", "decoded cache max", makeMaxSanitizerInt(0) };
+        SettingValue<int> mDecodingThreads{ mIndex, "Sound", "decoding threads", makeMaxSanitizerInt(1) };
         SettingValue<int> mHrtfEnable{ mIndex, "Sound", "hrtf enable", makeEnumSanitizerInt({ -1, 0, 1 }) };
         SettingValue<std::string> mHrtf{ mIndex, "Sound", "hrtf" };
     };
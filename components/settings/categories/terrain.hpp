@@ -37,6 +37,8 @@ namespace Settings
             makeMaxStrictSanitizerFloat(0) };
         SettingValue<float> mObjectPagingMinSizeCostMultiplier{ mIndex, "Terrain",
             "object paging min size cost multiplier", makeMaxStrictSanitizerFloat(0) };
+        SettingValue<int> mObjectPagingMergeGroups{ mIndex, "Terrain", "object paging merge groups",
+            makeMaxSanitizerInt(1) };
     };
 }
 
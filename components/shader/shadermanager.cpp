@@ -5,12 +5,14 @@
 #include <chrono>
 #include <components/debug/debuglog.hpp>
 #include <components/files/conversion.hpp>
+#include <components/misc/hash.hpp>
 #include <components/misc/strings/algorithm.hpp>
 #include <components/misc/strings/conversion.hpp>
 #include <components/misc/strings/format.hpp>
 #include <components/settings/settings.hpp>
 #include <filesystem>
 #include <fstream>
+#include <osg/GraphicsContext>
 #include <osg/Program>
 #include <osgViewer/Viewer>
 #include <regex>
@@ -51,6 +53,36 @@ namespace
         else
             return "";
     }
+
+    class CompileShadersOperation final : public osg::GraphicsOperation
+    {
+    public:
+        explicit CompileShadersOperation(std::vector<osg::ref_ptr<osg::Shader>>&& shaders)
+            : GraphicsOperation("CompileShadersOperation", false)
+            , mShaders(std::move(shaders))
+        {
+        }
+
+        void operator()(osg::GraphicsContext* graphicsContext) override
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (const osg::ref_ptr<osg::Shader>& shader : mShaders)
+                shader->compileShader(*graphicsContext->getState());
+            Log(Debug::Info) << "Compiled " << mShaders.size() << " preloaded shaders in "
+                             << std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count()
+                             << " ms";
+        }
+
+    private:
+        std::vector<osg::ref_ptr<osg::Shader>> mShaders;
+    };
+
+    bool isSerializable(std::string_view value)
+    {
+        return value.find_first_of("\t\n\r") == std::string_view::npos;
+    }
 }
 
 namespace Shader
@@ -523,6 +555,12 @@ namespace Shader
 
     osg::ref_ptr<osg::Shader> ShaderManager::getShader(
         std::string templateName, const ShaderManager::DefineMap& defines, std::optional<osg::Shader::Type> type)
+    {
+        return getOrCreateShader(std::move(templateName), defines, type, true);
+    }
+
+    osg::ref_ptr<osg::Shader> ShaderManager::getOrCreateShader(std::string templateName,
+        const ShaderManager::DefineMap& defines, std::optional<osg::Shader::Type> type, bool requested)
     {
         std::unique_lock<std::mutex> lock(mMutex);
 
@@ -558,7 +596,7 @@ namespace Shader
             templateIt = mShaderTemplates.insert(std::make_pair(templateName, source)).first;
         }
 
-        ShaderMap::iterator shaderIt = mShaders.find(std::make_pair(templateName, defines));
+        ShaderMap::iterator shaderIt = mShaders.find(MapKeyView{ templateName, defines });
         if (shaderIt == mShaders.end())
         {
             std::string shaderSource = templateIt->second;
@@ -585,6 +623,8 @@ namespace Shader
 
             shaderIt = mShaders.insert(std::make_pair(std::make_pair(templateName, defines), shader)).first;
         }
+        if (requested && shaderIt->second != nullptr)
+            mRequestedShaders.insert(&shaderIt->first);
         return shaderIt->second;
     }
 
@@ -658,6 +698,85 @@ namespace Shader
         }
     }
 
+    std::size_t ShaderManager::MapKeyHash::operator()(const MapKeyView& key) const
+    {
+        std::size_t seed = std::hash<std::string_view>{}(key.mTemplateName);
+        for (const auto& [name, value] : key.mDefines)
+        {
+            Misc::hashCombine(seed, name);
+            Misc::hashCombine(seed, value);
+        }
+        return seed;
+    }
+
+    void ShaderManager::saveShaderVariants(const std::filesystem::path& path)
+    {
+        std::ostringstream stream;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (const MapKey* key : mRequestedShaders)
+            {
+                if (!isSerializable(key->first))
+                    continue;
+                const bool serializable = std::all_of(key->second.begin(), key->second.end(),
+                    [](const auto& v) { return isSerializable(v.first) && isSerializable(v.second); });
+                if (!serializable)
+                    continue;
+                stream << static_cast<int>(mShaders.at(*key)->getType()) << '\t' << key->first;
+                for (const auto& [name, value] : key->second)
+                    stream << '\t' << name << '=' << value;
+                stream << '\n';
+            }
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        file << stream.str();
+        if (!file)
+            Log(Debug::Warning) << "Failed to write shader variants to " << Files::pathToUnicodeString(path);
+    }
+
+    osg::ref_ptr<osg::GraphicsOperation> ShaderManager::preloadShaderVariants(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return nullptr;
+
+        std::vector<osg::ref_ptr<osg::Shader>> shaders;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::vector<std::string> fields;
+            Misc::StringUtils::split(line, fields, "\t");
+            if (fields.size() < 2)
+                continue;
+
+            const auto type = Misc::StringUtils::toNumeric<int>(fields[0]);
+            if (!type.has_value())
+                continue;
+
+            DefineMap defines;
+            for (std::size_t i = 2; i < fields.size(); ++i)
+            {
+                const std::size_t separator = fields[i].find('=');
+                if (separator == std::string::npos)
+                    continue;
+                defines.emplace(fields[i].substr(0, separator), fields[i].substr(separator + 1));
+            }
+
+            if (osg::ref_ptr<osg::Shader> shader
+                = getOrCreateShader(fields[1], defines, static_cast<osg::Shader::Type>(*type), false))
+                shaders.push_back(std::move(shader));
+        }
+
+        Log(Debug::Info) << "Preloaded " << shaders.size() << " shader variants from "
+                         << Files::pathToUnicodeString(path);
+
+        if (shaders.empty())
+            return nullptr;
+
+        return new CompileShadersOperation(std::move(shaders));
+    }
+
     void ShaderManager::releaseGLObjects(osg::State* state)
     {
         std::lock_guard<std::mutex> lock(mMutex);
@@ -690,7 +809,7 @@ namespace Shader
 
         for (auto& linkedShaderName : linkedShaderNames)
         {
-            auto linkedShader = getShader(linkedShaderName, defines, shader->getType());
+            auto linkedShader = getOrCreateShader(linkedShaderName, defines, shader->getType(), false);
             if (linkedShader)
                 mLinkedShaders[shader].emplace_back(linkedShader);
         }
@@ -7,6 +7,9 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <osg/ref_ptr>
@@ -15,6 +18,11 @@
 #include <osg/Program>
 #include <osg/Shader>
 
+namespace osg
+{
+    class GraphicsOperation;
+}
+
 namespace osgViewer
 {
     class Viewer;
@@ -69,6 +77,16 @@ namespace Shader
 
         void releaseGLObjects(osg::State* state);
 
+        /// Write template names, types and defines of the shaders requested in this session, so they can be preloaded
+        /// by the next session. Preloaded shaders that were not requested again are left out.
+        void saveShaderVariants(const std::filesystem::path& path);
+
+        /// Create shaders for the variants written by saveShaderVariants in an earlier session.
+        /// @return Operation compiling the created shaders for the graphics context it runs on or nullptr if
+        /// nothing was created.
+        /// @note Global defines have to be set before.
+        osg::ref_ptr<osg::GraphicsOperation> preloadShaderVariants(const std::filesystem::path& path);
+
         bool createSourceFromTemplate(std::string& source, std::vector<std::string>& linkedShaderTemplateNames,
             const std::string& templateName, const ShaderManager::DefineMap& defines);
 
@@ -91,6 +109,10 @@ namespace Shader
         void triggerShaderReload();
 
     private:
+        /// @param requested Whether the shader is used in this session rather than created for preloading or linking.
+        osg::ref_ptr<osg::Shader> getOrCreateShader(
+            std::string templateName, const DefineMap& defines, std::optional<osg::Shader::Type> type, bool requested);
+
         void getLinkedShaders(osg::ref_ptr<osg::Shader> shader, const std::vector<std::string>& linkedShaderNames,
             const DefineMap& defines);
         void addLinkedShaders(osg::ref_ptr<osg::Shader> shader, osg::ref_ptr<osg::Program> program);
@@ -104,8 +126,44 @@ namespace Shader
         TemplateMap mShaderTemplates;
 
         typedef std::pair<std::string, DefineMap> MapKey;
-        typedef std::map<MapKey, osg::ref_ptr<osg::Shader>> ShaderMap;
+
+        // Allows to find a shader without copying the template name and the defines
+        struct MapKeyView
+        {
+            std::string_view mTemplateName;
+            const DefineMap& mDefines;
+        };
+
+        struct MapKeyHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(const MapKeyView& key) const;
+
+            std::size_t operator()(const MapKey& key) const { return (*this)(MapKeyView{ key.first, key.second }); }
+        };
+
+        struct MapKeyEqual
+        {
+            using is_transparent = void;
+
+            static MapKeyView toView(const MapKey& key) { return MapKeyView{ key.first, key.second }; }
+
+            static MapKeyView toView(const MapKeyView& key) { return key; }
+
+            template <class L, class R>
+            bool operator()(const L& l, const R& r) const
+            {
+                const MapKeyView lv = toView(l);
+                const MapKeyView rv = toView(r);
+                return lv.mTemplateName == rv.mTemplateName && lv.mDefines == rv.mDefines;
+            }
+        };
+
+        typedef std::unordered_map<MapKey, osg::ref_ptr<osg::Shader>, MapKeyHash, MapKeyEqual> ShaderMap;
         ShaderMap mShaders;
+        // Keys of mShaders, which are never erased
+        std::unordered_set<const MapKey*> mRequestedShaders;
 
         typedef std::map<std::pair<osg::ref_ptr<osg::Shader>, osg::ref_ptr<osg::Shader>>, osg::ref_ptr<osg::Program>>
             ProgramMap;